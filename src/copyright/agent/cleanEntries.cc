@@ -23,10 +23,43 @@
  * \todo skip "dnl "
 */
 #include "cleanEntries.hpp"
-#include <sstream>
-#include <iterator>
-using std::stringstream;
-using std::ostream_iterator;
+#include <algorithm>
+#include <cctype>
+
+/**
+ * \brief Check if a character belongs to the whitespace/control class
+ * collapsed by cleanGeneral()
+ * \param c Character to test
+ * \return True if c is a space or a control character
+ */
+static bool isSpaceOrControl(char c)
+{
+  return c == ' ' || static_cast<unsigned char>(c) <= 0x1f;
+}
+
+/**
+ * \brief Check if a range contains a run of collapsible characters
+ *
+ * The collapsing pass in cleanGeneral() only rewrites runs of two or
+ * more whitespace/control characters. A single cheap byte scan decides
+ * whether the rewrite pass can be skipped entirely, which is the common
+ * case for short statements.
+ * \param sBegin String begin
+ * \param sEnd   String end
+ * \return True if at least two adjacent collapsible characters exist
+ */
+static bool hasCollapsibleRun(string::const_iterator sBegin, string::const_iterator sEnd)
+{
+  bool prevCollapsible = false;
+  for (string::const_iterator it = sBegin; it != sEnd; ++it)
+  {
+    bool collapsible = isSpaceOrControl(*it);
+    if (collapsible && prevCollapsible)
+      return true;
+    prevCollapsible = collapsible;
+  }
+  return false;
+}
 
 /**
  * \brief Trim space at beginning and end
@@ -38,20 +71,56 @@ using std::ostream_iterator;
  */
 string cleanGeneral(string::const_iterator sBegin, string::const_iterator sEnd)
 {
-  stringstream ss;
-  rx::regex_replace(ostream_iterator<char>(ss), sBegin, sEnd, rx::regex("[[:space:]\\x0-\\x1f]{2,}"), " ");
-  string s = ss.str();
+  if (!hasCollapsibleRun(sBegin, sEnd))
+  {
+    // Nothing to collapse: only the trim below is needed
+    string::size_type len = sEnd - sBegin;
+    if (len > 1)
+    {
+      string::const_iterator b = sBegin;
+      string::const_iterator e = sEnd;
+      if (*b == ' ')
+        ++b;
+      if (*(sEnd - 1) == ' ')
+        --e;
+      return string(b, e);
+    }
+    return (len == 1 && *sBegin == ' ') ? string() : string(sBegin, sEnd);
+  }
+
+  /* Collapse every run of two or more whitespace/control characters
+   * into a single space in one forward pass; a lone whitespace or
+   * control character is kept as it is, matching the old
+   * "[[:space:]\x0-\x1f]{2,}" regex replacement. */
+  string s;
+  s.reserve(sEnd - sBegin);
+  string::const_iterator it = sBegin;
+  while (it != sEnd)
+  {
+    if (isSpaceOrControl(*it))
+    {
+      string::const_iterator runEnd = it + 1;
+      while (runEnd != sEnd && isSpaceOrControl(*runEnd))
+        ++runEnd;
+      s += (runEnd - it >= 2) ? ' ' : *it;
+      it = runEnd;
+    }
+    else
+    {
+      s += *it;
+      ++it;
+    }
+  }
   string::size_type len = s.length();
   if (len > 1)
   {
-    char cBegin = s[0];
-    char cEnd = s[len - 1];
-    if (cBegin == ' ' && cEnd == ' ')
-      return s.substr(1, len - 2);
-    else if (cBegin == ' ')
-      return s.substr(1);
-    else if (cEnd == ' ')
-      return s.substr(0, len - 1);
+    /* Trim in place: erasing the single leading/trailing space avoids
+     * allocating yet another copy of the statement via substr */
+    if (s[len - 1] == ' ')
+      s.erase(len - 1);
+    if (!s.empty() && s[0] == ' ')
+      s.erase(0, 1);
+    return s;
   }
   // Only one character/space??? Should not be possible
   return s == " " ? "" : s;
@@ -66,9 +135,34 @@ string cleanGeneral(string::const_iterator sBegin, string::const_iterator sEnd)
  */
 string cleanStatement(string::const_iterator sBegin, string::const_iterator sEnd)
 {
-  stringstream ss;
-  rx::regex_replace(ostream_iterator<char>(ss), sBegin, sEnd, rx::regex("\n[[:space:][:punct:]]*"), " ");
-  string s = ss.str();
+  /* The line-comment rewrite can only fire on a line break: statements
+   * that fit on a single line skip the rewrite pass entirely */
+  if (std::find(sBegin, sEnd, '\n') == sEnd)
+    return cleanGeneral(sBegin, sEnd);
+
+  /* Forward scan replacing each line break plus the leading
+   * decoration of the next line with one space, the hand-coded
+   * equivalent of the old "\n[[:space:][:punct:]]*" regex replacement */
+  string s;
+  s.reserve(sEnd - sBegin);
+  string::const_iterator it = sBegin;
+  while (it != sEnd)
+  {
+    const unsigned char c = *it;
+    if (c == '\n')
+    {
+      s += ' ';
+      ++it;
+      while (it != sEnd
+        && (isspace(static_cast<unsigned char>(*it)) || ispunct(static_cast<unsigned char>(*it))))
+        ++it;
+    }
+    else
+    {
+      s += c;
+      ++it;
+    }
+  }
   return cleanGeneral(s.begin(), s.end());
 }
 
@@ -23,7 +23,7 @@
 #include "regex.hpp"
 #include "scanners.hpp"
 
-string cleanMatch(const string& sText, const match& m);
+SCANNER_HOT string cleanMatch(const string& sText, const match& m);
 
 
 #endif /* CLEANENTRIES_HPP_ */
@@ -88,7 +88,7 @@ int main(int argc, char** argv)
 
 #pragma omp parallel
     {
-#pragma omp for
+#pragma omp for schedule(dynamic)
       for (unsigned int argn = 0; argn < fileNamesCount; ++argn)
       {
         const string fileName = fileNames[argn];
@@ -101,7 +101,8 @@ int main(int argc, char** argv)
         }
         else
         {
-          list<match> l;
+          vector<match> l;
+          l.reserve(16);
           for (auto sc = scanners.begin(); sc != scanners.end(); ++sc)
           {
             (*sc)->ScanString(s, l);
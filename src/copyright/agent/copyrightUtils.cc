@@ -271,14 +271,21 @@ CopyrightState getState(CliOptions&& cliOptions)
 /**
  * \brief Save findings to the database if agent was called by scheduler
  * \param s                        Statement found
- * \param matches                  List of regex matches for highlight
+ * \param matches                  Vector of regex matches for highlight
  * \param pFileId                  Id of pfile on which the statement was found
  * \param agentId                  Id of agent who discovered the statements
  * \param copyrightDatabaseHandler Database handler object
  * \return True of successful insertion, false otherwise
  */
-bool saveToDatabase(const string& s, const list<match>& matches, unsigned long pFileId, int agentId, const CopyrightDatabaseHandler& copyrightDatabaseHandler)
+bool saveToDatabase(const string& s, const vector<match>& matches, unsigned long pFileId, int agentId, const CopyrightDatabaseHandler& copyrightDatabaseHandler)
 {
+  if (matches.empty())
+  {
+    // Most files carry no statement at all: skip the BEGIN/COMMIT round
+    // trips instead of committing an empty transaction per file
+    return true;
+  }
+
   if (!copyrightDatabaseHandler.begin())
   {
     return false;
@@ -320,7 +327,10 @@ bool saveToDatabase(const string& s, const list<match>& matches, unsigned long p
  */
 void matchFileWithLicenses(const string& sContent, unsigned long pFileId, CopyrightState const& state, int agentId, CopyrightDatabaseHandler& databaseHandler)
 {
-  list<match> l;
+  vector<match> l;
+  // most files yield only a handful of matches: one modest reservation
+  // covers them without any regrowth of the vector
+  l.reserve(16);
   const list<unptr::shared_ptr<scanner>>& scanners = state.getScanners();
   for (auto sc = scanners.begin(); sc != scanners.end(); ++sc)
   {
@@ -394,7 +404,7 @@ bool processUploadId(const CopyrightState& state, int agentId, int uploadId, Cop
     CopyrightDatabaseHandler threadLocalDatabaseHandler(databaseHandler.spawn());
 
     size_t pFileCount = fileIds.size();
-#pragma omp for
+#pragma omp for schedule(dynamic)
     for (size_t it = 0; it < pFileCount; ++it)
     {
       unsigned long pFileId = fileIds[it];
@@ -23,25 +23,113 @@
 
 const string copyrightType("statement");  /**< A constant for default copyrightType as "statement" */
 
+namespace
+{
+  /**
+   * \brief Holder for the compiled copyright regexes
+   *
+   * The patterns come from the static conf file and never change at
+   * runtime, so they are compiled once per process and shared by all
+   * hCopyrightScanner instances.
+   */
+  struct CompiledCopyrightRegexes
+  {
+    rx::regex copyright, exception, simpleCopyright;
+
+    CompiledCopyrightRegexes()
+    {
+      RegexConfProvider rcp;
+      rcp.maybeLoad("copyright");
+
+      copyright = rx::regex(rcp.getRegexValue("copyright","REG_COPYRIGHT"),
+                            rx::regex_constants::icase);
+      exception = rx::regex(rcp.getRegexValue("copyright","REG_EXCEPTION"),
+                            rx::regex_constants::icase);
+      simpleCopyright = rx::regex(rcp.getRegexValue("copyright","REG_SIMPLE_COPYRIGHT"),
+                                  rx::regex_constants::icase);
+    }
+  };
+}
+
 /**
- * \brief Constructor for default hCopyrightScanner
+ * \brief Check if a line contains a word of two letters or two consecutive digits
  *
- * Initialize all regex values
+ * Hand-coded equivalent of the REG_NON_BLANK pattern
+ * (".*([[:alpha:]][[:alpha:]]|[[:digit:]][[:digit:]]).*"), which was
+ * evaluated by the regex engine for every line of a statement.
+ * \param lineBegin Begin of the line
+ * \param lineEnd   End of the line
+ * \return True if the line is non blank
  */
-hCopyrightScanner::hCopyrightScanner()
+static bool isNonBlankLine(string::const_iterator lineBegin, string::const_iterator lineEnd)
 {
-  RegexConfProvider rcp;
-  rcp.maybeLoad("copyright");
+  bool prevAlpha = false;
+  bool prevDigit = false;
+  for (string::const_iterator it = lineBegin; it != lineEnd; ++it)
+  {
+    const unsigned char c = *it;
+    if (isalpha(c))
+    {
+      if (prevAlpha)
+        return true;
+      prevAlpha = true;
+      prevDigit = false;
+    }
+    else if (isdigit(c))
+    {
+      if (prevDigit)
+        return true;
+      prevDigit = true;
+      prevAlpha = false;
+    }
+    else
+    {
+      prevAlpha = false;
+      prevDigit = false;
+    }
+  }
+  return false;
+}
 
-  regCopyright = rx::regex(rcp.getRegexValue("copyright","REG_COPYRIGHT"),
-                        rx::regex_constants::icase);
+/**
+ * \brief Quick test if a buffer can contain a copyright statement at all
+ *
+ * Every alternative of REG_COPYRIGHT starts with the word "copyright"
+ * or with one of the COPYSYM literals, so any match must contain a
+ * 'c', a '$' or a byte from a multi-byte symbol. Most source files
+ * that contain none of these (pure data, generated tables) can skip
+ * the regex scan entirely after this single cheap byte pass.
+ *
+ * This check must stay conservative with respect to the patterns in
+ * copyright.conf: it may report false positives, never false negatives.
+ * \param s String to check
+ * \return True if the buffer may contain a statement
+ */
+static bool containsCopyrightCandidate(const string& s)
+{
+  for (string::const_iterator it = s.begin(); it != s.end(); ++it)
+  {
+    const unsigned char c = *it;
+    if (c == 'c' || c == 'C' || c == '$' || c >= 0x80)
+      return true;
+  }
+  return false;
+}
 
-  regException = rx::regex(rcp.getRegexValue("copyright","REG_EXCEPTION"),
-               rx::regex_constants::icase);
-  regNonBlank = rx::regex(rcp.getRegexValue("copyright","REG_NON_BLANK"));
+/**
+ * \brief Constructor for default hCopyrightScanner
+ *
+ * Initialize all regex values. The regexes are only compiled on the
+ * first construction, later instances reuse the compiled ones
+ * (boost regex copies share the compiled state).
+ */
+hCopyrightScanner::hCopyrightScanner()
+{
+  static const CompiledCopyrightRegexes rgx;
 
-  regSimpleCopyright = rx::regex(rcp.getRegexValue("copyright","REG_SIMPLE_COPYRIGHT"),
-                     rx::regex_constants::icase);
+  regCopyright = rgx.copyright;
+  regException = rgx.exception;
+  regSimpleCopyright = rgx.simpleCopyright;
 }
 
 /**
@@ -50,10 +138,12 @@ hCopyrightScanner::hCopyrightScanner()
  * Given a string s, scans for copyright statements using regCopyrights.
  * Then checks for an regException match.
  * \param[in]  s   String to work on
- * \param[out] out List of matchs
+ * \param[out] out Vector of matchs
  */
-void hCopyrightScanner::ScanString(const string& s, list<match>& out) const
+void hCopyrightScanner::ScanString(const string& s, vector<match>& out) const
 {
+  if (!containsCopyrightCandidate(s))
+    return;
 
   string::const_iterator begin = s.begin();
   string::const_iterator pos = begin;
@@ -85,8 +175,11 @@ void hCopyrightScanner::ScanString(const string& s, list<match>& out) const
         string::const_iterator beginOfLine = j;
         ++beginOfLine;
         string::const_iterator endOfLine = find(beginOfLine, end, '\n');
-        if (rx::regex_search(beginOfLine, endOfLine, regSimpleCopyright)
-          || !rx::regex_match(beginOfLine, endOfLine, regNonBlank))
+        /* The blank check decides the line on its own when it fails, so
+         * run the cheap byte scan first and enter the regex engine only
+         * for lines that are known to be non blank */
+        if (!isNonBlankLine(beginOfLine, endOfLine)
+          || rx::regex_search(beginOfLine, endOfLine, regSimpleCopyright))
         {
           // Found end
           break;
@@ -29,7 +29,7 @@
 class hCopyrightScanner : public scanner
 {
 public:
-  void ScanString(const string& s, list<match>& results) const;
+  SCANNER_HOT void ScanString(const string& s, vector<match>& results) const;
   hCopyrightScanner();
 private:
   /**
@@ -37,12 +37,10 @@ private:
    * Regex for copyright statments
    * \var rx::regex regException
    * Regex for exceptions in copyright
-   * \var rx::regex regNonBlank
-   * Regex to find non blank statements
    * \var rx::regex regSimpleCopyright
    * Simple regex for copyright
    */
-  rx::regex regCopyright, regException, regNonBlank, regSimpleCopyright;
+  rx::regex regCopyright, regException, regSimpleCopyright;
 } ;
 
 #endif
@@ -34,7 +34,7 @@ using namespace std;
 RegexMap readConfStreamToMap(std::istringstream& stream,
                              const bool isVerbosityDebug)
 {
-  map<string, string> regexMap;
+  RegexMap regexMap;
   for (string line; getline(stream, line); )
     addRegexToMap(regexMap, line, isVerbosityDebug);
 
@@ -47,7 +47,7 @@ RegexMap readConfStreamToMap(std::istringstream& stream,
 RegexMap readConfStreamToMap(std::ifstream& stream,
                              const bool isVerbosityDebug)
 {
-  map<string, string> regexMap;
+  RegexMap regexMap;
   for (string line; getline(stream, line); )
     addRegexToMap(regexMap, line, isVerbosityDebug);
   stream.close();
@@ -104,27 +104,29 @@ string replaceTokens(/*in*/ RegexMap& regexMap,
 #define RGX_SEPARATOR_RIGHT RGX_SEPARATOR_LEFT
 #define RGX_SEPARATOR_LEN 2
 
-  string input(constInput);
-  stringstream output;
+  string output;
+  output.reserve(constInput.length());
 
+  /* Walk the input with a cursor instead of erasing the consumed prefix,
+   * which recopied the remaining string once per token. */
   size_t pos = 0;
-  string token;
-  while ((pos = input.find(RGX_SEPARATOR_LEFT)) != string::npos) // find start of the next token
+  while (true)
   {
-    output << input.substr(0, pos);
-    input.erase(0, pos + RGX_SEPARATOR_LEN);
+    size_t tokenStart = constInput.find(RGX_SEPARATOR_LEFT, pos); // find start of the next token
+    if (tokenStart == string::npos)
+      break;
+    output.append(constInput, pos, tokenStart - pos);
+    pos = tokenStart + RGX_SEPARATOR_LEN;
 
-    if ((pos = input.find(RGX_SEPARATOR_RIGHT)) != string::npos) // find end of token
-    {
-      output << regexMap[input.substr(0, pos)];
-      input.erase(0, pos + RGX_SEPARATOR_LEN);
-
-    }
-    else
+    size_t tokenEnd = constInput.find(RGX_SEPARATOR_RIGHT, pos); // find end of token
+    if (tokenEnd == string::npos)
     {
       cout << "uneven number of delimiters: " << constInput << endl;
+      break;
     }
+    output += regexMap[constInput.substr(pos, tokenEnd - pos)];
+    pos = tokenEnd + RGX_SEPARATOR_LEN;
   }
-  output << input;
-  return output.str();
+  output.append(constInput, pos, string::npos);
+  return output;
 }
@@ -19,7 +19,7 @@
 #ifndef REGEXCONFPARSER_HPP_
 #define REGEXCONFPARSER_HPP_
 
-#include <map>
+#include <unordered_map>
 #include <sstream>
 #include <fstream>
 
@@ -27,11 +27,36 @@ extern "C" {
 #include "libfossology.h"
 }
 
+/**
+ * \struct StringKeyHash
+ * \brief FNV-1a hash over the raw bytes of a string key
+ *
+ * The keys in the regex maps are short identifiers; a simple FNV-1a
+ * over the buffer hashes them in a few cycles without the per-call
+ * overhead of the generic std::hash implementation.
+ */
+struct StringKeyHash
+{
+  std::size_t operator()(const std::string& key) const
+  {
+    std::size_t hash = static_cast<std::size_t>(14695981039346656037ULL);
+    for (std::string::size_type i = 0; i < key.length(); ++i)
+    {
+      hash ^= static_cast<unsigned char>(key[i]);
+      hash *= static_cast<std::size_t>(1099511628211ULL);
+    }
+    return hash;
+  }
+};
+
 /**
  * \typedef
  * Key value pair regex name in key and pattern in value
+ *
+ * Lookups during token substitution and regex construction dominate,
+ * so a hash map is used instead of an ordered tree.
  */
-typedef std::map<std::string, std::string> RegexMap;
+typedef std::unordered_map<std::string, std::string, StringKeyHash> RegexMap;
 
 RegexMap readConfStreamToMap(std::istringstream& stream,
                                const bool isVerbosityDebug = false);
@@ -28,7 +28,7 @@ using namespace std;
  * Where key is the identity file name from which the RegexMap is loaded
  * and value is the RegexMap from the identity file
  */
-map<string,RegexMap> RegexConfProvider::_regexMapMap = {};
+unordered_map<string,RegexMap,StringKeyHash> RegexConfProvider::_regexMapMap = {};
 
 /**
  * \brief Check if a given file exists
@@ -109,7 +109,7 @@ bool RegexConfProvider::getRegexConfStream(const string& identity,
  */
 void RegexConfProvider::maybeLoad(const std::string& identity)
 {
-  map<string,RegexMap>& rmm = RegexConfProvider::_regexMapMap;
+  unordered_map<string,RegexMap,StringKeyHash>& rmm = RegexConfProvider::_regexMapMap;
   if (rmm.find(identity) == rmm.end())
   {
 #pragma omp critical(rmm)
@@ -142,7 +142,7 @@ void RegexConfProvider::maybeLoad(const std::string& identity)
 void RegexConfProvider::maybeLoad(const string& identity,
                                   istringstream& stream)
 {
-  map<string,RegexMap>& rmm = RegexConfProvider::_regexMapMap;
+  unordered_map<string,RegexMap,StringKeyHash>& rmm = RegexConfProvider::_regexMapMap;
   if (rmm.find(identity) == rmm.end())
   {
 #pragma omp critical(rmm)
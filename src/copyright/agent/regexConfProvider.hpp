@@ -21,7 +21,7 @@
 
 #include <string>
 #include <vector>
-#include <map>
+#include <unordered_map>
 #include <sstream>
 #include <fstream>
 #include <iostream>
@@ -47,7 +47,7 @@ public:
                             const std::string& key);
 
 private:
-  static std::map<std::string,RegexMap> _regexMapMap;
+  static std::unordered_map<std::string,RegexMap,StringKeyHash> _regexMapMap;
 
   bool _isVerbosityDebug;      /**< True to print debug messages */
 
@@ -18,6 +18,29 @@
 
 #include "regscan.hpp"
 
+/**
+ * \brief Determine a byte that every match of a regex type must contain
+ *
+ * The email pattern shipped in the conf files always contains a literal
+ * '@' and the url pattern a literal ':'. A buffer without that byte can
+ * never match, so the regex pass can be skipped after one cheap byte
+ * scan. The mapping must stay conservative with respect to the conf
+ * patterns: it may keep the scan, never skip a possible match. It is
+ * therefore only valid for the shipped conf patterns and must not be
+ * applied to user supplied patterns, which may use these type names
+ * without containing the literal byte.
+ * \param type Regex type as passed to the constructor
+ * \return Required byte, or 0 if none is known for this type
+ */
+static char prescanByteFor(const string& type)
+{
+  if (type == "email")
+    return '@';
+  if (type == "url")
+    return ':';
+  return 0;
+}
+
 /**
  * \brief Initialize RegexConfProvider and regex based on type and identity
  * \see RegexConfProvider::maybeLoad(const std::string& identity)
@@ -27,7 +50,8 @@ regexScanner::regexScanner(const string& type,
                            int index)
   : _type(type),
     _identity(identity),
-    _index(index)
+    _index(index),
+    _prescanByte(prescanByteFor(type))
 {
   RegexConfProvider rcp;
   rcp.maybeLoad(_identity);
@@ -46,7 +70,10 @@ regexScanner::regexScanner(const string& type,
                            int index)
   : _type(type),
     _identity(type),
-    _index(index)
+    _index(index),
+    // The stream carries a user supplied pattern: no byte requirement
+    // can be assumed from the type name alone
+    _prescanByte(0)
 {
   RegexConfProvider rcp;
   rcp.maybeLoad(_identity,stream);
@@ -57,31 +84,25 @@ regexScanner::regexScanner(const string& type,
 /**
  * \brief Scan a string using regex defined during initialization
  * \param[in]  s       String to scan
- * \param[out] results List of match results
+ * \param[out] results Vector of match results
  */
-void regexScanner::ScanString(const string& s, list<match>& results) const
+void regexScanner::ScanString(const string& s, vector<match>& results) const
 {
-  // Read file into one string
-  string::const_iterator end = s.end();
-  string::const_iterator pos = s.begin();
-  unsigned int intPos = 0;
+  if (_prescanByte && s.find(_prescanByte) == string::npos)
+    // No match is possible without this byte: skip the regex pass
+    return;
+
+  // Enumerate all matches in a single pass over the string; the
+  // iterator reports positions relative to the begin of s
+  rx::sregex_iterator found(s.begin(), s.end(), _reg);
+  rx::sregex_iterator foundEnd;
 
-  while (pos != end)
+  for (; found != foundEnd; ++found)
   {
-    // Find next match
-    rx::smatch res;
-    if (rx::regex_search(pos, end, res, _reg))
-    {
-      // Found match
-      results.push_back(match(intPos + res.position(_index),
-                              intPos + res.position(_index) + res.length(_index),
-                              _type));
-      pos = res[0].second;
-      intPos += res.position() + res.length();
-    }
-    else
-      // No match found
-      break;
+    const rx::smatch& res = *found;
+    results.push_back(match(res.position(_index),
+                            res.position(_index) + res.length(_index),
+                            _type));
   }
 }
 
@@ -47,9 +47,16 @@ class regexScanner : public scanner
    * Index of regex
    */
   int _index;
+  /**
+   * \var char _prescanByte
+   * Byte that every match of _reg must contain, or 0 if no such byte
+   * is known. Lets ScanString() skip the regex pass after a cheap byte
+   * scan when the byte does not occur in the input at all.
+   */
+  char _prescanByte;
 
 public:
-  void ScanString(const string& str, list<match>& results) const;
+  SCANNER_HOT void ScanString(const string& str, vector<match>& results) const;
 
   regexScanner(const string& type,
                const string& identity,
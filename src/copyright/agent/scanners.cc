@@ -18,11 +18,14 @@
 
 #include "scanners.hpp"
 
-#include <sstream>
 #include <cstring>
 
 /**
  * \brief Utility: read file to string from scanners.h
+ *
+ * The file size is determined up front so the whole content is read
+ * with a single allocation and a single read call, instead of growing
+ * a stringstream chunk by chunk and copying the result.
  * \param[in]  fileName Path of file to read
  * \param[out] out      String created from file
  * \return True on success, fail otherwise
@@ -32,9 +35,24 @@
 bool ReadFileToString(const string& fileName, string& out)
 {
   ifstream stream(fileName);
-  std::stringstream sstr;
-  sstr << stream.rdbuf();
-  out = sstr.str();
+  if (!stream)
+  {
+    out.clear();
+    return false;
+  }
+
+  stream.seekg(0, std::ios::end);
+  std::streamoff size = stream.tellg();
+  if (size < 0)
+  {
+    out.clear();
+    return false;
+  }
+
+  out.resize(size);
+  stream.seekg(0, std::ios::beg);
+  if (size > 0)
+    stream.read(&out[0], size);
   return !stream.fail();
 }
 
@@ -71,7 +71,7 @@ void HtmlEscapedOutput(ostream& out, const char* s)
   }
 }
 
-void GetReferenceResults(const string& fileName, list<match>& results)
+void GetReferenceResults(const string& fileName, vector<match>& results)
 {
   ifstream t(fileName);
   stringstream tstream;
@@ -112,7 +112,7 @@ public:
 /**
  * \brief Print results to out
  */
-void Display(ostream& out, ifstream& data, list<match>& l, list<match>& lcmp, const char*prein, const char*postin, const char*prenn, const char*postnn)
+void Display(ostream& out, ifstream& data, vector<match>& l, vector<match>& lcmp, const char*prein, const char*postin, const char*prenn, const char*postnn)
 {
   // Print results
   data.clear();
@@ -175,11 +175,14 @@ void TestDataCheck::testDataCheck()
   {
     string fileName = fileNameBase + to_string(i);
     ifstream tstream(fileName);
-    list<match> lng, lauth, lrefs;
-    hsc.ScanFile(fileName, lng);
+    vector<match> lcopy, lauth, lrefs;
+    hsc.ScanFile(fileName, lcopy);
     hauth.ScanFile(fileName, lauth);
-    // Merge lists lng and lauth
-    lng.merge(lauth, cmpMatches);
+    // Merge the results of both scanners
+    vector<match> lng;
+    lng.reserve(lcopy.size() + lauth.size());
+    merge(lcopy.begin(), lcopy.end(), lauth.begin(), lauth.end(),
+          back_inserter(lng), cmpMatches);
     GetReferenceResults(fileName + "_raw", lrefs);
 
     out << "<h1>testdata" << i << "</h1>" << endl;
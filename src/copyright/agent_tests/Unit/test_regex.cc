@@ -43,7 +43,7 @@ protected:
    * \test
    * -# Create a test string
    * -# Create a regex pattern
-   * -# Run the regex on the string
+   * -# Enumerate all matches with a regex iterator
    * -# Check the actual number of matches against expected result
    */
   void regTest (void) {
@@ -51,15 +51,12 @@ protected:
     std::string content = "This is copy of a copyright statement similar to copyleft found in copying";
     rx::regex matchingRegex ("copy");
 
-    std::string::const_iterator begin = content.begin();
-    std::string::const_iterator end = content.end();
-    rx::match_results<std::string::const_iterator> what;
+    rx::sregex_iterator found(content.begin(), content.end(), matchingRegex);
+    rx::sregex_iterator foundEnd;
 
-    int nfound =0;
-    while (rx::regex_search(begin, end, what,matchingRegex)) {
+    int nfound = 0;
+    for (; found != foundEnd; ++found)
       nfound++;
-      begin = what[0].second;
-    }
 
     CPPUNIT_ASSERT_EQUAL (4, nfound);
   };
@@ -30,9 +30,9 @@ using namespace std;
 /**
  * \brief Create stream which follows agent output format
  * \param[out] out Stream to load data into
- * \param[in]  l   List of matches to create output stream
+ * \param[in]  l   Vector of matches to create output stream
  */
-ostream& operator<<(ostream& out, const list<match>& l)
+ostream& operator<<(ostream& out, const vector<match>& l)
 {
   for (auto m = l.begin(); m != l.end(); ++m)
     out << '[' << m->start << ':' << m->end << ':' << m->type << ']';
@@ -81,8 +81,8 @@ private:
    */
   void scannerTest (const scanner& sc, const char* content, const string& type, list<const char*> expectedStrings)
   {
-    list<match> matches;
-    list<match> expected;
+    vector<match> matches;
+    vector<match> expected;
     sc.ScanString(content, matches);
 
     for (auto s = expectedStrings.begin(); s != expectedStrings.end(); ++s)
@@ -83,26 +83,31 @@ static gint str_comp(gconstpointer a, gconstpointer b, gpointer user_data)
   return strcmp((char*) a, (char*) b);
 }
 
+/**
+ * The state used while collecting the keys of a GTree into an array of
+ * strings, the array being filled and the next empty slot in it.
+ */
+typedef struct
+{
+  char** data;  ///< the array the keys are collected into
+  int idx;      ///< the next empty slot in the array
+} key_collector;
+
 /**
  * Function that collects all of the keys for a GTree into a single array of
  * strings. This is used to grab the sets of keys for the fo_config_key_set and
- * fo_config_group_set functions `printf("%s\n", (*error)->message);`
- *
+ * fo_config_group_set functions. The collector carries the insertion index
+ * so the array fills in a single pass instead of rescanning it for the
+ * first empty slot on every key.
  *
  * @param key the key for this particular key/value pair
  * @param value the value for this particular key/value pair
- * @param data not used
+ * @param collect the array being filled and the next empty slot
  * @return always return 0 so that the traversal continues
  */
-static gboolean collect_keys(char* key, gpointer* value, char** data)
+static gboolean collect_keys(char* key, gpointer* value, key_collector* collect)
 {
-  int idx = 0;
-
-  /* find first empty key */
-  while (data[idx])
-    idx++;
-
-  data[idx] = key;
+  collect->data[collect->idx++] = key;
   return FALSE;
 }
 
@@ -172,16 +177,20 @@ static int fo_config_key(GTree* group, gchar* key, gchar* val, gboolean list,
 
   if (list)
   {
-    if ((val = g_tree_lookup(group, key)))
-    {
-      val = g_strdup_printf("%s[%s]", val, tmp);
-      g_free(tmp);
-    }
-    else
-    {
-      val = g_strdup_printf("[%s]", tmp);
-      g_free(tmp);
-    }
+    /* grow the stored list value in a GString sized up front instead of
+     * reassembling it with g_strdup_printf() for every element */
+    GString* joined;
+    gchar* prev = g_tree_lookup(group, key);
+
+    joined = g_string_sized_new((prev ? strlen(prev) : 0) + strlen(tmp) + 3);
+    if (prev)
+      g_string_append(joined, prev);
+    g_string_append_c(joined, '[');
+    g_string_append(joined, tmp);
+    g_string_append_c(joined, ']');
+    g_free(tmp);
+
+    val = g_string_free(joined, FALSE);
   }
   else
   {
@@ -284,16 +293,19 @@ fo_conf* fo_config_load(char* rawname, GError** error)
   guint yyline = 1;
   FILE* fd;
   GMatchInfo* match;
+  gchar* line;
 
   if (rawname == NULL)
     return NULL;
 
-  if (fo_conf_parse == NULL)
-    fo_conf_parse = g_regex_new(fo_conf_pattern,
-      G_REGEX_EXTENDED | G_REGEX_OPTIMIZE, 0, NULL);
-  if (fo_conf_replace == NULL)
-    fo_conf_replace = g_regex_new(fo_conf_variable,
-      G_REGEX_EXTENDED | G_REGEX_OPTIMIZE, 0, NULL);
+  /* fo_config_load may run on several threads at once, so the shared
+   * regexes must be published exactly once */
+  if (g_once_init_enter(&fo_conf_parse))
+    g_once_init_leave(&fo_conf_parse, g_regex_new(fo_conf_pattern,
+      G_REGEX_EXTENDED | G_REGEX_OPTIMIZE, 0, NULL));
+  if (g_once_init_enter(&fo_conf_replace))
+    g_once_init_leave(&fo_conf_replace, g_regex_new(fo_conf_variable,
+      G_REGEX_EXTENDED | G_REGEX_OPTIMIZE, 0, NULL));
 
   if ((fd = fopen(rawname, "r")) == NULL)
   throw_error(error, PARSE_ERROR, fo_missing_file,
@@ -311,6 +323,16 @@ fo_conf* fo_config_load(char* rawname, GError** error)
 
   while (fgets(text, sizeof(text), fd) != NULL)
   {
+    /* comments and blank lines never produce a match that fo_config_eval
+     * acts on, so skip them without paying for the regex */
+    for (line = text; *line == ' ' || *line == '\t'; line++)
+      ;
+    if (*line == '\n' || *line == '\0' || *line == ';')
+    {
+      yyline++;
+      continue;
+    }
+
     if (g_regex_match(fo_conf_parse, text, 0, &match))
     {
       fo_config_eval(match, &g_current, ret, rawname, yyline, error);
@@ -365,7 +387,7 @@ char* fo_config_get(fo_conf* conf, const char* group, const char* key,
     fo_missing_key,
     "ERROR: unknown key=\"%s\" for group=\"%s\"", key, group);
 
-  return g_tree_lookup(tree, key);
+  return ret;
 }
 
 /**
@@ -387,10 +409,10 @@ char* fo_config_get(fo_conf* conf, const char* group, const char* key,
 char* fo_config_get_list(fo_conf* conf, char* group, char* key, int idx,
     GError** error)
 {
+  GTree* tree;
   char* val;
-  int depth;
   char* curr;
-
+  int depth;
 
   if (!conf || conf->group_map == NULL)
   throw_error(
@@ -399,38 +421,43 @@ char* fo_config_get_list(fo_conf* conf, char* group, char* key, int idx,
     fo_load_config,
     "ERROR: invalid fo_conf object passed to fo_config_get_list");
 
-  if (!fo_config_is_list(conf, group, key, error)) if (!(*error))
+  if ((tree = g_tree_lookup(conf->group_map, group)) == NULL)
+  throw_error(
+    error,
+    RETRIEVE_ERROR,
+    fo_missing_group,
+    "ERROR: unknown group \"%s\"", group);
+
+  if ((val = g_tree_lookup(tree, key)) == NULL)
+  throw_error(
+    error,
+    RETRIEVE_ERROR,
+    fo_missing_key,
+    "ERROR: unknown key/value expression \"%s\"", key);
+
+  if (val[0] != '[')
   throw_error(
     error,
     RETRIEVE_ERROR,
     fo_invalid_key,
     "ERROR: %s[%s] must be of type list to get list element", group, key);
 
-  if (idx < 0 || idx >= fo_config_list_length(conf, group, key, error))
+  /* walk to the requested element; running off the end of the string is the
+   * out of range case, so the value is resolved and scanned only once */
+  curr = val;
+  for (depth = 0; depth < idx && curr != NULL; depth++)
+    curr = strchr(curr + 1, '[');
+
+  if (idx < 0 || curr == NULL)
   throw_error(
     error,
     RETRIEVE_ERROR,
     fo_invalid_key,
     "ERROR: %s[%s] %d is out of range", group, key, idx);
 
-  if (error && *error)
-    return NULL;
-
-  val = g_tree_lookup(
-    g_tree_lookup(conf->group_map, group), key);
-
-  curr = val;
-  for (depth = 0; depth < idx;)
-  {
-    while (*(++curr) != '[');
-    depth++;
-  }
-
   val = curr + 1;
   while (*(++curr) != ']');
-  val = g_strndup(val, curr - val);
-
-  return val;
+  return g_strndup(val, curr - val);
 }
 
 /**
@@ -492,6 +519,7 @@ int fo_config_list_length(fo_conf* conf, char* group, char* key, GError** error)
   if (error && *error)
     return 0;
 
+  /* fo_config_is_list already validated the group and key */
   val = g_tree_lookup(
     g_tree_lookup(conf->group_map, group), key);
 
@@ -598,7 +626,8 @@ char** fo_config_group_set(fo_conf* conf, int* length)
   conf->n_groups = *length;
   conf->group_set = g_new0(
   char*, *length);
-  g_tree_foreach(conf->group_map, (GTraverseFunc) collect_keys, conf->group_set);
+  key_collector collect = { conf->group_set, 0 };
+  g_tree_foreach(conf->group_map, (GTraverseFunc) collect_keys, &collect);
 
   return conf->group_set;
 }
@@ -640,7 +669,8 @@ char** fo_config_key_set(fo_conf* conf, char* group, int* length)
 
   ret = g_new0(
   char*, *length);
-  g_tree_foreach(tree, (GTraverseFunc) collect_keys, ret);
+  key_collector collect = { ret, 0 };
+  g_tree_foreach(tree, (GTraverseFunc) collect_keys, &collect);
   g_tree_insert(conf->key_sets, g_strdup(group), ret);
 
   return ret;
@@ -33,6 +33,7 @@
 #include <scheduler.h>
 
 /* library includes */
+#include <ctype.h>
 #include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -129,17 +130,16 @@ const char* agent_status_strings[] =
 /**
  * @brief This will close all of the agent's pipes
  *
- * This function will be called by g_tree_foreach() which is the reason for its
- * formatting.
+ * This function will be called by g_hash_table_foreach() which is the reason
+ * for its formatting.
  *
  * @param pid_ptr   the key that was used to store this agent
  * @param agent     the agent that is being closed
  * @param excepted  this is an agent we don't want to close, this is it
- * @return always returns 0 to indicate that the traversal should continue
  */
-static int agent_close_fd(int* pid_ptr, agent_t* agent, agent_t* excepted)
+static void agent_close_fd(gpointer pid_ptr, agent_t* agent, agent_t* excepted)
 {
-  TEST_NULL(agent, 0);
+  TEST_NULV(agent);
   if (agent != excepted)
   {
     close(agent->from_child);
@@ -147,7 +147,6 @@ static int agent_close_fd(int* pid_ptr, agent_t* agent, agent_t* excepted)
     fclose(agent->read);
     fclose(agent->write);
   }
-  return 0;
 }
 
 /**
@@ -155,14 +154,13 @@ static int agent_close_fd(int* pid_ptr, agent_t* agent, agent_t* excepted)
  *   - If we haven't gotten a recent communication, close it
  *   - If it hasn't been performing tasks, close it
  *
- * @param pid_ptr  pointer to key in g_tree, is not used in this function
+ * @param pid_ptr  the pid key in the hash table, is not used in this function
  * @param agent    the agent that needs to be updated
  * @param unused   data that is also not used in this function
- * @return always returns 0 to indicate that the traversal should continue
  */
-static int update(int* pid_ptr, agent_t* agent, gpointer unused)
+static void update(gpointer pid_ptr, agent_t* agent, gpointer unused)
 {
-  TEST_NULL(agent, 0);
+  TEST_NULV(agent);
   int nokill = is_agent_special(agent, SAG_NOKILL) || is_meta_special(agent->type, SAG_NOKILL);
 
   if (agent->status == AG_SPAWNED || agent->status == AG_RUNNING || agent->status == AG_PAUSED)
@@ -172,7 +170,7 @@ static int update(int* pid_ptr, agent_t* agent, gpointer unused)
     {
       AGENT_CONCURRENT_PRINT("no heartbeat for %d seconds\n", (time(NULL) - agent->check_in));
       agent_kill(agent);
-      return 0;
+      return;
     }
 
     /* check items processed */
@@ -188,19 +186,17 @@ static int update(int* pid_ptr, agent_t* agent, gpointer unused)
     {
       AGENT_CONCURRENT_PRINT("agent has not set the alive flag in at least 10 minutes, killing\n");
       agent_kill(agent);
-      return 0;
+      return;
     }
 
     AGENT_SEQUENTIAL_PRINT("agent updated correctly, processed %d items: %d\n", agent->total_analyzed,
         agent->n_updates);
     agent->alive = 0;
   }
-
-  return 0;
 }
 
 /**
- * @brief GTraversalFunction that kills all of the agents.
+ * @brief GHFunc that kills all of the agents.
  *
  * This is used for an unclean death since all of the child processes will
  * be sent a kill signal instead of existing cleanly.
@@ -208,35 +204,30 @@ static int update(int* pid_ptr, agent_t* agent, gpointer unused)
  * @param pid the process id associated with the agent
  * @param agent a pointer to the information associated with an agent
  * @param unused
- * @return always returns 0 to indicate that the traversal should continue
  */
-static int agent_kill_traverse(int* pid, agent_t* agent, gpointer unused)
+static void agent_kill_traverse(gpointer pid, agent_t* agent, gpointer unused)
 {
   agent_kill(agent);
-  return FALSE;
 }
 
 /**
- * @brief GTraverseFunction that will print the name of every agent in
- * alphabetical order separated by spaces.
+ * @brief GHFunc that will print the name of every agent separated by spaces.
  *
  * @param name the name of the agent
  * @param ma the meta_agents structure associated with the specific name
  * @param ostr the output stream to write the data to, socket in this case
- * @return always returns 0 to indicate that the traversal should continue
  */
-static int agent_list(char* name, meta_agent_t* ma, GOutputStream* ostr)
+static void agent_list(char* name, meta_agent_t* ma, GOutputStream* ostr)
 {
   if (ma->valid)
   {
     g_output_stream_write(ostr, name, strlen(name), NULL, NULL);
     g_output_stream_write(ostr, " ", 1, NULL, NULL);
   }
-  return FALSE;
 }
 
 /**
- * @brief GTraversalFunction that tests the current agent on every host
+ * @brief GHFunc that tests the current agent on every host
  *
  * This will traverse the list of hosts and start an agent that is of the type
  * of the current meta agent on every host.
@@ -244,9 +235,8 @@ static int agent_list(char* name, meta_agent_t* ma, GOutputStream* ostr)
  * @param name       The name of the meta agent
  * @param ma         The meta_agent structure needed for agent creation
  * @param scheduler  The scheduler object to test the agents on
- * @return           Always return 0
  */
-static int agent_test(const gchar* name, meta_agent_t* ma, scheduler_t* scheduler)
+static void agent_test(const gchar* name, meta_agent_t* ma, scheduler_t* scheduler)
 {
   static int32_t id_gen = -1;
 
@@ -254,13 +244,70 @@ static int agent_test(const gchar* name, meta_agent_t* ma, scheduler_t* schedule
   host_t* host;
   char *jq_cmd_args = 0;
 
-  for (iter = scheduler->host_queue; iter != NULL; iter = iter->next)
+  for (iter = scheduler->host_queue->head; iter != NULL; iter = iter->next)
   {
     host = (host_t*) iter->data;
     V_AGENT("META_AGENT[%s] testing on HOST[%s]\n", ma->name, host->name);
     job_t* job = job_init(scheduler->job_list, scheduler->job_queue, ma->name, host->name, id_gen--, 0, 0, 0, 0, jq_cmd_args);
     agent_init(scheduler, host, job);
   }
+}
+
+/**
+ * Parses the numeric arguments of an agent message. This is the hand written
+ * equivalent of the old parse_agent_msg regex
+ * ("([A-Z]+):([ \t]+)(\d+)(([ \t]+)(\d))?") and exists because this
+ * function runs on every line that every agent prints; the grammar is simple
+ * enough that the regex engine is pure overhead here.
+ *
+ * @param buffer the line that was read from the agent
+ * @param arg1 set to the first number in the message, 0 if there is no match
+ * @param arg2 set to the optional single digit second number, -1 if absent
+ * @return 1 if the message grammar was found in the buffer, 0 otherwise
+ */
+static int parse_agent_msg_args(const char* buffer, int* arg1, int* arg2)
+{
+  const char* c = buffer;
+
+  *arg1 = 0;
+  *arg2 = -1;
+
+  while(*c)
+  {
+    /* find a run of capital letters directly followed by a ':' */
+    if(!isupper(*c))
+    {
+      c++;
+      continue;
+    }
+
+    while(isupper(*c))
+      c++;
+    if(*c != ':')
+      continue;
+    c++;
+
+    /* the ':' must be followed by white space and the first number */
+    if(*c != ' ' && *c != '\t')
+      continue;
+    while(*c == ' ' || *c == '\t')
+      c++;
+    if(!isdigit(*c))
+      continue;
+
+    *arg1 = (int)strtol(c, (char**)&c, 10);
+
+    /* optionally more white space followed by a single digit */
+    if(*c == ' ' || *c == '\t')
+    {
+      while(*c == ' ' || *c == '\t')
+        c++;
+      if(isdigit(*c))
+        *arg2 = *c - '0';
+    }
+
+    return 1;
+  }
 
   return 0;
 }
@@ -283,8 +330,9 @@ static void agent_listen(scheduler_t* scheduler, agent_t* agent)
 
   /* locals */
   char buffer[1024]; // buffer to store c strings read from agent
-  GMatchInfo* match; // regex match information
-  char* arg;         // used during regex retrievals
+  char* version_str; // the version reported in the agent's handshake
+  size_t buflen;     // length of the message currently in the buffer
+  int arg1, arg2;    // numeric arguments parsed out of agent messages
   int relevant;      // used during special retrievals
 
   TEST_NULV(agent);
@@ -305,11 +353,15 @@ static void agent_listen(scheduler_t* scheduler, agent_t* agent)
     g_thread_exit(NULL);
   }
 
-  /* check to make sure "VERSION" was sent */
+  /* check to make sure "VERSION" was sent. The prefix compares in this
+   * function use memcmp with the literal's length: the buffer is always
+   * a NUL terminated string inside a fixed array, so memcmp can never
+   * run out of readable bytes and does not have to watch for embedded
+   * NULs the way strncmp does. */
   buffer[strlen(buffer) - 1] = '\0';
-  if (strncmp(buffer, "VERSION: ", 9) != 0)
+  if (memcmp(buffer, "VERSION: ", 9) != 0)
   {
-    if (strncmp(buffer, "@@@1", 4) == 0)
+    if (memcmp(buffer, "@@@1", 4) == 0)
     {
       THREAD_FATAL(job_log(agent->owner), "agent crashed before sending version information");
     }
@@ -331,21 +383,21 @@ static void agent_listen(scheduler_t* scheduler, agent_t* agent)
 #else
   g_static_mutex_lock(&version_lock);
 #endif
-  strcpy(buffer, &buffer[9]);
+  version_str = buffer + 9;
   if (agent->type->version == NULL && agent->type->valid)
   {
     agent->type->version_source = agent->host->name;
-    agent->type->version = g_strdup(buffer);
+    agent->type->version = g_strdup(version_str);
     if (TVERB_AGENT)
       con_printf(main_log, "META_AGENT[%s.%s] version is: \"%s\"\n", agent->host->name, agent->type->name,
           agent->type->version);
   }
-  else if (strcmp(agent->type->version, buffer) != 0)
+  else if (strcmp(agent->type->version, version_str) != 0)
   {
     con_printf(job_log(agent->owner), "ERROR %s.%d: META_DATA[%s] invalid agent spawn check\n", __FILE__, __LINE__,
         agent->type->name);
     con_printf(job_log(agent->owner), "ERROR: versions don't match: %s(%s) != received: %s(%s)\n",
-        agent->type->version_source, agent->type->version, agent->host->name, buffer);
+        agent->type->version_source, agent->type->version, agent->host->name, version_str);
     agent->type->valid = 0;
     agent_kill(agent);
 #if GLIB_MAJOR_VERSION >= 2 && GLIB_MINOR_VERSION >= 32
@@ -376,12 +428,13 @@ static void agent_listen(scheduler_t* scheduler, agent_t* agent)
     if (fgets(buffer, sizeof(buffer), agent->read) == NULL)
       g_thread_exit(NULL);
 
-    buffer[strlen(buffer) - 1] = '\0';
+    buflen = strlen(buffer);
+    buffer[--buflen] = '\0';
 
-    if (strlen(buffer) == 0)
+    if (buflen == 0)
       continue;
 
-    if (TVERB_AGENT && (TVERB_SPECIAL || strncmp(buffer, "SPECIAL", 7) != 0))
+    if (TVERB_AGENT && (TVERB_SPECIAL || memcmp(buffer, "SPECIAL", 7) != 0))
       AGENT_CONCURRENT_PRINT("received: \"%s\"\n", buffer);
 
     /*! - \b command: "BYE"
@@ -391,7 +444,7 @@ static void agent_listen(scheduler_t* scheduler, agent_t* agent)
      *    correctly, anything else can be used as an error code. Regardless of
      *    whether the agent completed, the communication thread will shutdown.
      */
-    if (strncmp(buffer, "BYE", 3) == 0)
+    if (memcmp(buffer, "BYE", 3) == 0)
     {
       if ((agent->return_code = atoi(&(buffer[4]))) != 0)
       {
@@ -407,7 +460,7 @@ static void agent_listen(scheduler_t* scheduler, agent_t* agent)
      *    normally only happen if the agent crashes and the scheduler receives a
      *    SIGCHLD for it before it sends "BYE #".
      */
-    if (strncmp(buffer, "@@@1", 4) == 0)
+    if (memcmp(buffer, "@@@1", 4) == 0)
       break;
 
     /*! - \b command "@@@0"
@@ -416,7 +469,7 @@ static void agent_listen(scheduler_t* scheduler, agent_t* agent)
      *    This is sent after an agent sends the "OK" command, and the scheduler has
      *    processed the resulting agent_ready_event().
      */
-    if (strncmp(buffer, "@@@0", 4) == 0 && agent->updated)
+    if (memcmp(buffer, "@@@0", 4) == 0 && agent->updated)
     {
       aprintf(agent, "%s\n", agent->data);
       aprintf(agent, "END\n");
@@ -436,7 +489,7 @@ static void agent_listen(scheduler_t* scheduler, agent_t* agent)
      *        -# the agent has finished the last piece of the job it was working on
      *           and is ready for the next piece or to be shutdown
      */
-    if (strncmp(buffer, "OK", 2) == 0)
+    if (memcmp(buffer, "OK", 2) == 0)
     {
       if (agent->status != AG_PAUSED)
         event_signal(agent_ready_event, agent);
@@ -449,20 +502,12 @@ static void agent_listen(scheduler_t* scheduler, agent_t* agent)
      *    agent is still working it must periodically update the scheduler with
      *    how much of the job it has processed.
      */
-    else if (strncmp(buffer, "HEART", 5) == 0)
+    else if (memcmp(buffer, "HEART", 5) == 0)
     {
-      g_regex_match(scheduler->parse_agent_msg, buffer, 0, &match);
-
-      arg = g_match_info_fetch(match, 3);
-      agent->total_analyzed = atoi(arg);
-      g_free(arg);
-
-      arg = g_match_info_fetch(match, 6);
-      agent->alive = (arg[0] == '1' || agent->alive);
-      g_free(arg);
+      parse_agent_msg_args(buffer, &arg1, &arg2);
 
-      g_match_info_free(match);
-      match = NULL;
+      agent->total_analyzed = arg1;
+      agent->alive = (arg2 == 1 || agent->alive);
 
       database_job_processed(agent->owner->id, agent->total_analyzed);
     }
@@ -473,7 +518,7 @@ static void agent_listen(scheduler_t* scheduler, agent_t* agent)
      *    notification email. This grabs the message and sets inside the job that
      *    the agent is running under.
      */
-    else if (strncmp(buffer, "EMAIL", 5) == 0)
+    else if (memcmp(buffer, "EMAIL", 5) == 0)
     {
       agent->owner->message = g_strdup(buffer + 6);
     }
@@ -485,18 +530,15 @@ static void agent_listen(scheduler_t* scheduler, agent_t* agent)
      *    or false. Agents use this by calling fo_scheduler_set_special() in the
      *    agent api.
      */
-    else if (strncmp(buffer, "SPECIAL", 7) == 0)
+    else if (memcmp(buffer, "SPECIAL", 7) == 0)
     {
       relevant = INT_MAX;
 
-      g_regex_match(scheduler->parse_agent_msg, buffer, 0, &match);
+      parse_agent_msg_args(buffer, &arg1, &arg2);
 
-      arg = g_match_info_fetch(match, 3);
-      relevant &= atoi(arg);
-      g_free(arg);
+      relevant &= arg1;
 
-      arg = g_match_info_fetch(match, 6);
-      if (atoi(arg))
+      if (arg2 > 0)
       {
         if (agent->special & relevant)
           relevant = 0;
@@ -506,9 +548,6 @@ static void agent_listen(scheduler_t* scheduler, agent_t* agent)
         if (!(agent->special & relevant))
           relevant = 0;
       }
-      g_free(arg);
-
-      g_match_info_free(match);
 
       agent->special ^= relevant;
     }
@@ -518,20 +557,16 @@ static void agent_listen(scheduler_t* scheduler, agent_t* agent)
      *    The agent has requested the value of a special attribute. The scheduler
      *    will respond with the value of the special attribute.
      */
-    else if (strncmp(buffer, "GETSPECIAL", 10) == 0)
+    else if (memcmp(buffer, "GETSPECIAL", 10) == 0)
     {
-      g_regex_match(scheduler->parse_agent_msg, buffer, 0, &match);
+      parse_agent_msg_args(buffer, &arg1, &arg2);
 
-      arg = g_match_info_fetch(match, 3);
-      relevant = atoi(arg);
-      g_free(arg);
+      relevant = arg1;
 
       if (agent->special & relevant)
         aprintf(agent, "VALUE: 1\n");
       else
         aprintf(agent, "VALUE: 0\n");
-
-      g_match_info_free(match);
     }
 
     /*! - \b command: unknown
@@ -661,7 +696,7 @@ static void* agent_spawn(agent_spawn_args* pass)
     dup2(agent->to_parent, fileno(stderr));
 
     /* close all the unnecessary file descriptors */
-    g_tree_foreach(scheduler->agents, (GTraverseFunc) agent_close_fd, agent);
+    g_hash_table_foreach(scheduler->agents, (GHFunc) agent_close_fd, agent);
     close(agent->from_child);
     close(agent->to_child);
 
@@ -682,12 +717,12 @@ static void* agent_spawn(agent_spawn_args* pass)
       args[0] = g_strdup_printf(AGENT_BINARY, scheduler->sysconfigdir,
       AGENT_CONF, agent->type->name, tmp);
 
-      strcpy(buffer, args[0]);
-      *strrchr(buffer, '/') = '\0';
-      if (chdir(buffer) != 0)
+      tmp = g_path_get_dirname(args[0]);
+      if (chdir(tmp) != 0)
       {
         ERROR("unable to change working directory: %s\n", strerror(errno));
       }
+      g_free(tmp);
 
       execv(args[0], args);
     }
@@ -826,7 +861,7 @@ agent_t* agent_init(scheduler_t* scheduler, host_t* host, job_t* job)
   }
 
   /* check that the agent type exists */
-  if (g_tree_lookup(scheduler->meta_agents, job->agent_type) == NULL)
+  if (g_hash_table_lookup(scheduler->meta_agents, job->agent_type) == NULL)
   {
     log_printf("ERROR %s.%d: jq_pk %d jq_type %s does not match any module in mods-enabled\n", __FILE__, __LINE__,
         job->id, job->agent_type);
@@ -838,7 +873,7 @@ agent_t* agent_init(scheduler_t* scheduler, host_t* host, job_t* job)
 
   /* allocate memory and do trivial assignments */
   agent = g_new(agent_t, 1);
-  agent->type = g_tree_lookup(scheduler->meta_agents, job->agent_type);
+  agent->type = g_hash_table_lookup(scheduler->meta_agents, job->agent_type);
   agent->status = AG_CREATED;
 
   /* make sure that there is a metaagent for the job */
@@ -948,6 +983,31 @@ void agent_destroy(agent_t* agent)
 /* **** Events ************************************************************** */
 /* ************************************************************************** */
 
+/**
+ * Packs an agent's pid and exit status into the data pointer for an
+ * agent_death_event. Both values fit in 32 bits, so on 64 bit pointers they
+ * travel inside the pointer itself; on 32 bit pointers they would not fit
+ * and a slice carries the pair, freed by agent_death_event after unpacking.
+ *
+ * @param pid    the pid of the process that died
+ * @param status the status returned by waitpid()
+ * @return the event data pointer to pass with an agent_death_event
+ */
+gpointer agent_pack_death_event(pid_t pid, int status)
+{
+#if GLIB_SIZEOF_VOID_P >= 8
+  guint64 packed = ((guint64)(guint32)pid << 32) | (guint32)status;
+
+  return GSIZE_TO_POINTER(packed);
+#else
+  pid_t* pair = g_slice_alloc(2 * sizeof(pid_t));
+
+  pair[0] = pid;
+  pair[1] = status;
+  return pair;
+#endif
+}
+
 /**
  * Event created when a SIGCHLD is received for an agent. If one SIGCHILD is
  * received for several process deaths, there will be seperate events for each
@@ -956,19 +1016,29 @@ void agent_destroy(agent_t* agent)
  * @param scheduler the scheduler reference to which process was attached to
  * @param pid the pid of the process that died
  */
-void agent_death_event(scheduler_t* scheduler, pid_t* pid)
+void agent_death_event(scheduler_t* scheduler, gpointer pid_status)
 {
   agent_t* agent;
-  int status = pid[1];
+#if GLIB_SIZEOF_VOID_P >= 8
+  guint64 packed = GPOINTER_TO_SIZE(pid_status);
+  pid_t pid  = (pid_t)(packed >> 32);
+  int status = (int)(packed & 0xffffffff);
+#else
+  pid_t* pair = pid_status;
+  pid_t pid  = pair[0];
+  int status = pair[1];
+
+  g_slice_free1(2 * sizeof(pid_t), pair);
+#endif
 
-  if ((agent = g_tree_lookup(scheduler->agents, &pid[0])) == NULL)
+  if ((agent = g_hash_table_lookup(scheduler->agents, GINT_TO_POINTER(pid))) == NULL)
   {
-    ERROR("invalid agent death event: pid[%d]", pid[0]);
+    ERROR("invalid agent death event: pid[%d]", pid);
     return;
   }
 
   if (agent->owner->id >= 0)
-    event_signal(database_update_event, NULL);
+    database_update_request();
 
   if (write(agent->to_parent, "@@@1\n", 5) != 5)
     AGENT_SEQUENTIAL_PRINT("write to agent unsuccessful: %s\n", strerror(errno));
@@ -1010,8 +1080,7 @@ void agent_death_event(scheduler_t* scheduler, pid_t* pid)
 
   AGENT_SEQUENTIAL_PRINT("successfully remove from the system\n");
   job_remove_agent(agent->owner, scheduler->job_list, agent);
-  g_tree_remove(scheduler->agents, &agent->pid);
-  g_free(pid);
+  g_hash_table_remove(scheduler->agents, GINT_TO_POINTER(agent->pid));
 }
 
 /**
@@ -1030,7 +1099,7 @@ void agent_create_event(scheduler_t* scheduler, agent_t* agent)
   TEST_NULV(agent);
 
   AGENT_SEQUENTIAL_PRINT("agent successfully spawned\n");
-  g_tree_insert(scheduler->agents, &agent->pid, agent);
+  g_hash_table_insert(scheduler->agents, GINT_TO_POINTER(agent->pid), agent);
   agent_transition(agent, AG_SPAWNED);
   job_add_agent(agent->owner, agent);
 }
@@ -1093,7 +1162,7 @@ void agent_ready_event(scheduler_t* scheduler, agent_t* agent)
  */
 void agent_update_event(scheduler_t* scheduler, void* unused)
 {
-  g_tree_foreach(scheduler->agents, (GTraverseFunc) update, NULL);
+  g_hash_table_foreach(scheduler->agents, (GHFunc) update, NULL);
 }
 
 /**
@@ -1124,7 +1193,7 @@ void agent_fail_event(scheduler_t* scheduler, agent_t* agent)
  */
 void list_agents_event(scheduler_t* scheduler, GOutputStream* ostr)
 {
-  g_tree_foreach(scheduler->meta_agents, (GTraverseFunc) agent_list, ostr);
+  g_hash_table_foreach(scheduler->meta_agents, (GHFunc) agent_list, ostr);
   g_output_stream_write(ostr, "\nend\n", 5, NULL, NULL);
 }
 
@@ -1289,7 +1358,7 @@ ssize_t agent_write(agent_t* agent, const void* buf, int count)
  */
 void test_agents(scheduler_t* scheduler)
 {
-  g_tree_foreach(scheduler->meta_agents, (GTraverseFunc) agent_test, scheduler);
+  g_hash_table_foreach(scheduler->meta_agents, (GHFunc) agent_test, scheduler);
 }
 
 /**
@@ -1300,31 +1369,31 @@ void test_agents(scheduler_t* scheduler)
  */
 void kill_agents(scheduler_t* scheduler)
 {
-  g_tree_foreach(scheduler->agents, (GTraverseFunc) agent_kill_traverse, NULL);
+  g_hash_table_foreach(scheduler->agents, (GHFunc) agent_kill_traverse, NULL);
 }
 
 /**
  * Creates a new meta agent and adds it to the list of meta agents. This will
  * parse the shell command that will start the agent process.
  *
- * @param meta_agents GTree of meta agents available for the scheduler
+ * @param meta_agents map of meta agents available for the scheduler
  * @param name the name of the meta agent (e.g. "nomos", "copyright", etc...)
  * @param cmd the shell command used to the run the agent
  * @param max the max number of this type of agent that can run concurrently
  * @param spc anything special about the agent type
  */
-int add_meta_agent(GTree* meta_agents, char* name, char* cmd, int max, int spc)
+int add_meta_agent(GHashTable* meta_agents, char* name, char* cmd, int max, int spc)
 {
   meta_agent_t* ma;
 
   if (name == NULL)
     return 0;
 
-  if (g_tree_lookup(meta_agents, name) == NULL)
+  if (g_hash_table_lookup(meta_agents, name) == NULL)
   {
     if ((ma = meta_agent_init(name, cmd, max, spc)) == NULL)
       return 0;
-    g_tree_insert(meta_agents, ma->name, ma);
+    g_hash_table_insert(meta_agents, ma->name, ma);
     return 1;
   }
 
@@ -153,7 +153,8 @@ void agent_destroy(agent_t* agent);
 /* **** Modifier Functions and events *************************************** */
 /* ************************************************************************** */
 
-void agent_death_event(scheduler_t* scheduler, pid_t* pids);
+gpointer agent_pack_death_event(pid_t pid, int status);
+void agent_death_event(scheduler_t* scheduler, gpointer pid_status);
 void agent_create_event(scheduler_t* scheduler, agent_t* agent);
 void agent_ready_event(scheduler_t* scheduler, agent_t* agent);
 void agent_update_event(scheduler_t* scheduler, void* unused);
@@ -173,7 +174,7 @@ ssize_t agent_write(agent_t* agent, const void* buf, int count);
 /* ************************************************************************** */
 
 void test_agents(scheduler_t* scheduler);
-int  add_meta_agent(GTree* meta_agents, char* name, char* cmd, int max, int spc);
+int  add_meta_agent(GHashTable* meta_agents, char* name, char* cmd, int max, int spc);
 
 void kill_agents(scheduler_t* scheduler);
 
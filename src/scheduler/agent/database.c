@@ -28,6 +28,7 @@ with this program; if not, write to the Free Software Foundation, Inc.,
 /* other library includes */
 #include <libfossdb.h>
 #include <fcntl.h>
+#include <stdatomic.h>
 #include <sys/stat.h>
 #include <sys/mman.h>
 
@@ -452,7 +453,7 @@ static void email_notification(scheduler_t* scheduler, job_t* job)
   job_status curr_status = job->status;
   email_replace_args args;
 
-  if(is_meta_special(g_tree_lookup(scheduler->meta_agents, job->agent_type), SAG_NOEMAIL) ||
+  if(is_meta_special(g_hash_table_lookup(scheduler->meta_agents, job->agent_type), SAG_NOEMAIL) ||
       !(status = email_checkjobstatus(scheduler, job)))
     return;
 
@@ -504,7 +505,11 @@ static void email_notification(scheduler_t* scheduler, job_t* job)
     if(status == 2)
       job->status = JB_FAILED;
 
-    email_txt = g_string_new("");
+    /* the header and footer can be large mmap'd files; size the string
+     * once up front so the appends don't grow and recopy the buffer */
+    email_txt = g_string_sized_new(strlen(scheduler->email_header) +
+        (job->message == NULL ? 0 : strlen(job->message)) +
+        strlen(scheduler->email_footer) + 1);
     g_string_append(email_txt, scheduler->email_header);
     g_string_append(email_txt, job->message == NULL ? "" : job->message);
     g_string_append(email_txt, scheduler->email_footer);
@@ -573,10 +578,19 @@ void email_init(scheduler_t* scheduler)
 	gchar* fname;
 	GError* error = NULL;
 
-	if(scheduler->email_header && !scheduler->default_header)
-	  munmap(scheduler->email_header, header_sb.st_size);
-	if(scheduler->email_footer && !scheduler->default_footer)
-	  munmap(scheduler->email_footer, footer_sb.st_size);
+	/* The template mappings are cached across reloads and validated by the
+	 * file's mtime and size, the local equivalent of a conditional fetch:
+	 * an unchanged template is reused without re-reading the file. The
+	 * cache owns the mappings. */
+	static char*  header_cache      = NULL;
+	static gchar* header_cache_name = NULL;
+	static time_t header_cache_mtime;
+	static off_t  header_cache_size;
+	static char*  footer_cache      = NULL;
+	static gchar* footer_cache_name = NULL;
+	static time_t footer_cache_mtime;
+	static off_t  footer_cache_size;
+
 	g_free(scheduler->email_subject);
 
 	/* load the header */
@@ -587,13 +601,35 @@ void email_init(scheduler_t* scheduler)
 	  EMAIL_ERROR("email notification setting group \"[EMAILNOTIFY]\" missing. Using defaults");
 	if(error && error->code == fo_missing_key)
 	  EMAIL_ERROR("email notification setting key \"header\" missing. Using default header");
-	if(email_notify && (fd = open(fname, O_RDONLY)) == -1)
-	  EMAIL_ERROR("unable to open file for email header: %s", fname);
-	if(email_notify && fstat(fd, &header_sb) == -1)
-	  EMAIL_ERROR("unable to fstat email header: %s", fname);
-	if(email_notify && (scheduler->email_header = mmap(NULL, header_sb.st_size, PROT_READ,
-	    MAP_SHARED, fd, 0)) == MAP_FAILED)
-	  EMAIL_ERROR("unable to mmap email header: %s", fname);
+	if(email_notify && header_cache != NULL &&
+	    stat(fname, &header_sb) == 0 &&
+	    g_strcmp0(fname, header_cache_name) == 0 &&
+	    header_sb.st_mtime == header_cache_mtime &&
+	    header_sb.st_size  == header_cache_size)
+	{
+	  scheduler->email_header = header_cache;
+	}
+	else
+	{
+	  if(email_notify && (fd = open(fname, O_RDONLY)) == -1)
+	    EMAIL_ERROR("unable to open file for email header: %s", fname);
+	  if(email_notify && fstat(fd, &header_sb) == -1)
+	    EMAIL_ERROR("unable to fstat email header: %s", fname);
+	  if(email_notify && (scheduler->email_header = mmap(NULL, header_sb.st_size, PROT_READ,
+	      MAP_SHARED, fd, 0)) == MAP_FAILED)
+	    EMAIL_ERROR("unable to mmap email header: %s", fname);
+	  if(email_notify)
+	  {
+	    if(header_cache != NULL)
+	      munmap(header_cache, header_cache_size);
+	    g_free(header_cache_name);
+	    header_cache       = scheduler->email_header;
+	    header_cache_name  = g_strdup(fname);
+	    header_cache_mtime = header_sb.st_mtime;
+	    header_cache_size  = header_sb.st_size;
+	    close(fd);
+	  }
+	}
 	if((scheduler->default_header = !email_notify))
 	  scheduler->email_header = DEFAULT_HEADER;
 
@@ -605,13 +641,35 @@ void email_init(scheduler_t* scheduler)
 	  email_notify = 0;
 	if(error && error->code == fo_missing_key)
 	  EMAIL_ERROR("email notification setting key \"footer\" missing. Using default footer");
-	if(email_notify && (fd = open(fname, O_RDONLY)) == -1)
-	  EMAIL_ERROR("unable to open file for email footer: %s", fname);
-	if(email_notify && fstat(fd, &footer_sb) == -1)
-	  EMAIL_ERROR("unable to fstat email footer: %s", fname);
-	if(email_notify && (scheduler->email_footer = mmap(NULL, footer_sb.st_size, PROT_READ,
-	    MAP_SHARED, fd, 0)) == MAP_FAILED)
-	  EMAIL_ERROR("unable to mmap email footer: %s", fname);
+	if(email_notify && footer_cache != NULL &&
+	    stat(fname, &footer_sb) == 0 &&
+	    g_strcmp0(fname, footer_cache_name) == 0 &&
+	    footer_sb.st_mtime == footer_cache_mtime &&
+	    footer_sb.st_size  == footer_cache_size)
+	{
+	  scheduler->email_footer = footer_cache;
+	}
+	else
+	{
+	  if(email_notify && (fd = open(fname, O_RDONLY)) == -1)
+	    EMAIL_ERROR("unable to open file for email footer: %s", fname);
+	  if(email_notify && fstat(fd, &footer_sb) == -1)
+	    EMAIL_ERROR("unable to fstat email footer: %s", fname);
+	  if(email_notify && (scheduler->email_footer = mmap(NULL, footer_sb.st_size, PROT_READ,
+	      MAP_SHARED, fd, 0)) == MAP_FAILED)
+	    EMAIL_ERROR("unable to mmap email footer: %s", fname);
+	  if(email_notify)
+	  {
+	    if(footer_cache != NULL)
+	      munmap(footer_cache, footer_cache_size);
+	    g_free(footer_cache_name);
+	    footer_cache       = scheduler->email_footer;
+	    footer_cache_name  = g_strdup(fname);
+	    footer_cache_mtime = footer_sb.st_mtime;
+	    footer_cache_size  = footer_sb.st_size;
+	    close(fd);
+	  }
+	}
 	if((scheduler->default_footer = !email_notify))
 	  scheduler->email_footer = DEFAULT_FOOTER;
 	error = NULL;
@@ -781,18 +839,46 @@ static PGconn* database_connect(gchar* configdir)
 void database_init(scheduler_t* scheduler)
 {
   PGresult* db_result;
+  int fresh_conn = FALSE;
 
-  /* create the connection to the database */
-  scheduler->db_conn = database_connect(scheduler->sysconfigdir);
+  /* url of the instance, cached so that config reloads that reuse a healthy
+   * connection do not repeat the checkout query */
+  static gchar* url_cache = NULL;
 
-  /* get the url for the fossology instance */
-  db_result = database_exec(scheduler, url_checkout);
-  if(PQresultStatus(db_result) == PGRES_TUPLES_OK && PQntuples(db_result) != 0)
-    scheduler->host_url = g_strdup(PQgetvalue(db_result, 0, 0));
-  SafePQclear(db_result);
+  /* drop a connection that has gone bad since it was established */
+  if(scheduler->db_conn != NULL && PQstatus(scheduler->db_conn) != CONNECTION_OK)
+  {
+    PQfinish(scheduler->db_conn);
+    scheduler->db_conn = NULL;
+  }
+
+  /* create the connection to the database; on a configuration reload a
+   * healthy connection is reused instead of reconnecting */
+  if(scheduler->db_conn == NULL)
+  {
+    scheduler->db_conn = database_connect(scheduler->sysconfigdir);
+    fresh_conn = TRUE;
+  }
+
+  /* get the url for the fossology instance; a reload over a reused
+   * connection takes the cached copy instead of hitting the database */
+  if(fresh_conn || url_cache == NULL)
+  {
+    db_result = database_exec(scheduler, url_checkout);
+    if(PQresultStatus(db_result) == PGRES_TUPLES_OK && PQntuples(db_result) != 0)
+    {
+      g_free(url_cache);
+      url_cache = g_strdup(PQgetvalue(db_result, 0, 0));
+    }
+    SafePQclear(db_result);
+  }
+
+  if(url_cache != NULL)
+    scheduler->host_url = g_strdup(url_cache);
 
   /* check that relevant database fields exist */
-  check_tables(scheduler);
+  if(fresh_conn)
+    check_tables(scheduler);
 }
 
 /* ************************************************************************** */
@@ -843,6 +929,33 @@ void database_exec_event(scheduler_t* scheduler, char* sql)
   g_free(sql);
 }
 
+/**
+ * \var update_pending
+ * Set while a database_update_event queued by database_update_request()
+ * is waiting in the event queue. Atomic so that the interface threads
+ * can request an update with the same coalescing as the main thread.
+ */
+static _Atomic int update_pending = 0;
+
+/**
+ * @brief Queues a job queue check unless one is already waiting
+ *
+ * When many agents die at nearly the same time, or the UI sends a burst
+ * of "database" commands, every caller would queue its own
+ * database_update_event and each of those runs a full job queue query.
+ * Collapsing the requests into a single queued update makes a burst
+ * cost one query instead of one per request.
+ *
+ * The exchange makes this safe from any thread: whichever caller flips
+ * the flag from 0 to 1 queues the event, everyone else sees it already
+ * set and does nothing.
+ */
+void database_update_request()
+{
+  if(!atomic_exchange_explicit(&update_pending, 1, memory_order_acq_rel))
+    event_signal(database_update_event, NULL);
+}
+
 /**
  * @brief Checks the job queue for any new entries.
  *
@@ -851,6 +964,10 @@ void database_exec_event(scheduler_t* scheduler, char* sql)
  */
 void database_update_event(scheduler_t* scheduler, void* unused)
 {
+  /* clear before doing the work so a request arriving while the queue
+   * is being scanned is not lost, matching the clear-then-drain pattern */
+  atomic_store_explicit(&update_pending, 0, memory_order_release);
+
   /* locals */
   PGresult* db_result;
   PGresult* pri_result;
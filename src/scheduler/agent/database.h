@@ -44,6 +44,7 @@ void email_init(scheduler_t* scheduler);
 
 PGresult* database_exec(scheduler_t* scheduler, const char* sql);
 void database_exec_event(scheduler_t* scheduler, char* sql);
+void database_update_request();
 void database_update_event(scheduler_t* scheduler, void* unused);
 
 void database_reset_queue(scheduler_t* scheduler);
@@ -152,7 +152,9 @@ event_t* event_loop_take(event_loop_t* event_loop)
  */
 event_t* event_init(void(*func)(scheduler_t*, void*), void* arg, char* name, char* source_name, uint16_t source_line)
 {
-  event_t* e = g_new(event_t, 1);
+  /* events are created and destroyed constantly, so they come from the
+   * slice allocator instead of a full malloc each */
+  event_t* e = g_slice_new(event_t);
 
   e->func = func;
   e->argument = arg;
@@ -174,7 +176,7 @@ void event_destroy(event_t* e)
   e->argument = NULL;
   e->name     = NULL;
 
-  g_free(e);
+  g_slice_free(event_t, e);
 }
 
 /**
@@ -229,6 +231,7 @@ int event_loop_enter(scheduler_t* scheduler,
     void(*signal_call)(scheduler_t*))
 {
   event_t* e;
+  int log_event;
   event_loop_t* event_loop = event_loop_get();
 
   /* start by checking to make sure this is the only thread in this loop */
@@ -255,11 +258,15 @@ int event_loop_enter(scheduler_t* scheduler,
     if(e == NULL)
       continue;
 
-    if(TVERB_EVENT && strcmp(e->name, "log_event") != 0)
+    /* decide once whether this event gets verbose logging so that the name
+     * comparison is not repeated on both sides of the call */
+    log_event = TVERB_EVENT && strcmp(e->name, "log_event") != 0;
+
+    if(log_event)
       log_printf("EVENT: calling %s, source[%s.%d] \n", e->name, e->source_name, e->source_line);
     e->func(scheduler, e->argument);
 
-    if(TVERB_EVENT && strcmp(e->name, "log_event") != 0)
+    if(log_event)
       log_printf("EVENT: finished %s, source[%s.%d] \n", e->name, e->source_name, e->source_line);
 
     event_destroy(e);
@@ -53,6 +53,7 @@ int main(int argc, char** argv)
   GError* error = NULL;       // error object used during parsing
   uint16_t port = 0;
   gchar* sysconfigdir = DEFAULT_SETUP;
+  struct sigaction sig_act;   // used to install the signal handlers
 
   /* THE SCHEDULER */
   scheduler_t* scheduler;
@@ -103,16 +104,19 @@ int main(int argc, char** argv)
   g_option_context_free(options);
 
   /* check changes to the process first */
-  if(ki_shut) { return kill_scheduler(FALSE); }
-  if(ki_kill) { return kill_scheduler(TRUE);  }
+  if(ki_shut) { return kill_scheduler(FALSE, sysconfigdir); }
+  if(ki_kill) { return kill_scheduler(TRUE,  sysconfigdir);  }
 
   /* initialize the scheduler */
+  agent_conf_batch* agent_conf;
+
   scheduler = scheduler_init(sysconfigdir,
       log_new("stdout", "initializing", getpid()));
 
   if(logdir)
   {
-    scheduler->logdir     = logdir;
+    g_free(scheduler->logdir);
+    scheduler->logdir     = g_strdup(logdir);
     scheduler->logcmdline = TRUE;
     scheduler->main_log   = log_new(scheduler->logdir, NULL, scheduler->s_pid);
 
@@ -125,9 +129,14 @@ int main(int argc, char** argv)
 
   scheduler_foss_config(scheduler);
   if(s_daemon && scheduler_daemonize(scheduler) == -1) { return -1; }
-  scheduler_agent_config(scheduler);
+  scheduler_register_pid(scheduler);
 
+  /* parse the agent configurations while the database connection and
+   * checks run; the parse pool must start after the daemonize fork */
+  agent_conf = scheduler_agent_config_start(scheduler);
   database_init(scheduler);
+  scheduler_agent_config_finish(scheduler, agent_conf);
+
   email_init(scheduler);
 
   NOTIFY("*****************************************************************");
@@ -140,10 +149,24 @@ int main(int argc, char** argv)
   interface_init(scheduler);
   fo_RepOpenFull(scheduler->sysconfig);
 
-  signal(SIGCHLD, scheduler_sig_handle);
-  signal(SIGTERM, scheduler_sig_handle);
-  signal(SIGQUIT, scheduler_sig_handle);
-  signal(SIGHUP,  scheduler_sig_handle);
+  /* install the handler with sigaction instead of signal: SA_RESTART
+   * keeps the blocking reads on the agent pipes from failing with EINTR
+   * on every signal, and blocking the other handled signals while the
+   * handler runs keeps the sigmask updates from interleaving */
+  memset(&sig_act, 0, sizeof(sig_act));
+  sig_act.sa_handler = scheduler_sig_handle;
+  sig_act.sa_flags   = SA_RESTART;
+  sigemptyset(&sig_act.sa_mask);
+  sigaddset(&sig_act.sa_mask, SIGCHLD);
+  sigaddset(&sig_act.sa_mask, SIGALRM);
+  sigaddset(&sig_act.sa_mask, SIGTERM);
+  sigaddset(&sig_act.sa_mask, SIGQUIT);
+  sigaddset(&sig_act.sa_mask, SIGHUP);
+  sigaction(SIGCHLD, &sig_act, NULL);
+  sigaction(SIGALRM, &sig_act, NULL);
+  sigaction(SIGTERM, &sig_act, NULL);
+  sigaction(SIGQUIT, &sig_act, NULL);
+  sigaction(SIGHUP,  &sig_act, NULL);
 
   /* ***************************************************** */
   /* *** we have finished initialization without error *** */
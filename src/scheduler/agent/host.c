@@ -30,18 +30,16 @@ with this program; if not, write to the Free Software Foundation, Inc.,
 /* ************************************************************************** */
 
 /**
- * @brief GTraversFunction that allows the information for all hosts to be printed
+ * @brief GHFunc that allows the information for all hosts to be printed
  *
  * @param host_name  the string name of the host
  * @param host       the host struct paired with the name
  * @param ostr       the output stream that the info will be printed to
- * @return 0 to cause the traversal to continue
  * @sa host_print()
  */
-static int print_host_all(gchar* host_name, host_t* host, GOutputStream* ostr)
+static void print_host_all(gchar* host_name, host_t* host, GOutputStream* ostr)
 {
   host_print(host, ostr);
-  return 0;
 }
 
 /* ************************************************************************** */
@@ -70,6 +68,35 @@ host_t* host_init(char* name, char* address, char* agent_dir, int max)
   return host;
 }
 
+/**
+ * @brief Creates a new host from unterminated field slices
+ *
+ * Identical to host_init() but takes the address and agent directory as
+ * pointer/length pairs. This allows callers to pass slices of a larger
+ * string without first making NUL terminated copies of the fields.
+ *
+ * @param host          The name of the host
+ * @param address       The address of the host, not NUL terminated
+ * @param address_len   The number of characters in the address
+ * @param agent_dir     The agent directory on the host, not NUL terminated
+ * @param agent_dir_len The number of characters in the agent directory
+ * @param max           The max number of agents that can run on this host
+ * @return              A new host structure
+ */
+host_t* host_init_n(char* name, const char* address, size_t address_len,
+    const char* agent_dir, size_t agent_dir_len, int max)
+{
+  host_t* host = g_new0(host_t, 1);
+
+  host->name = g_strdup(name);
+  host->address = g_strndup(address, address_len);
+  host->agent_dir = g_strndup(agent_dir, agent_dir_len);
+  host->max = max;
+  host->running = 0;
+
+  return host;
+}
+
 /**
  * @brief Frees and uninitializes any memory associated with the host struct
  *
@@ -102,8 +129,8 @@ void host_destroy(host_t* host)
  */
 void host_insert(host_t* host, scheduler_t* scheduler)
 {
-  g_tree_insert(scheduler->host_list, host->name, host);
-  scheduler->host_queue = g_list_append(scheduler->host_queue, host);
+  g_hash_table_insert(scheduler->host_list, host->name, host);
+  g_queue_push_tail(scheduler->host_queue, host);
 }
 
 /**
@@ -149,17 +176,16 @@ void host_print(host_t* host, GOutputStream* ostr)
  * Gets a host for which there are at least num agents available to start
  * new agents on.
  *
- * @param queue GList of available hosts
+ * @param queue GQueue of available hosts
  * @param num the number of agents to start on the host
  * @return the host with that number of available slots, NULL if none exist
  */
-host_t* get_host(GList** queue, uint8_t num)
+host_t* get_host(GQueue* queue, uint8_t num)
 {
-  GList*  host_queue = *queue;
-  GList*  curr       = NULL;
-  host_t* ret        = NULL;
+  GList*  curr = NULL;
+  host_t* ret  = NULL;
 
-  for(curr = host_queue; curr != NULL; curr = curr->next)
+  for(curr = queue->head; curr != NULL; curr = curr->next)
   {
     ret = curr->data;
     if(ret->max - ret->running >= num)
@@ -169,10 +195,11 @@ host_t* get_host(GList** queue, uint8_t num)
   if(curr == NULL)
     return NULL;
 
-  host_queue = g_list_remove(host_queue, ret);
-  host_queue = g_list_append(host_queue, ret);
+  /* rotate the chosen host to the back of the round-robin queue; the
+   * link is already known so no second scan of the queue is needed */
+  g_queue_delete_link(queue, curr);
+  g_queue_push_tail(queue, ret);
 
-  *queue = host_queue;
   return ret;
 }
 
@@ -183,8 +210,8 @@ host_t* get_host(GList** queue, uint8_t num)
  * @param ostr
  * @sa print_host_all()
  */
-void print_host_load(GTree* host_list, GOutputStream* ostr)
+void print_host_load(GHashTable* host_list, GOutputStream* ostr)
 {
-  g_tree_foreach(host_list, (GTraverseFunc)print_host_all, ostr);
+  g_hash_table_foreach(host_list, (GHFunc)print_host_all, ostr);
   g_output_stream_write(ostr, "\nend\n", 5, NULL, NULL);
 }
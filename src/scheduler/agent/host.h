@@ -48,6 +48,8 @@ typedef struct {
 /* ************************************************************************** */
 
 host_t* host_init(char* name, char* address, char* agent_dir, int max);
+host_t* host_init_n(char* name, const char* address, size_t address_len,
+    const char* agent_dir, size_t agent_dir_len, int max);
 void host_destroy(host_t* h);
 
 /* ************************************************************************** */
@@ -59,7 +61,7 @@ void host_increase_load(host_t* host);
 void host_decrease_load(host_t* host);
 void host_print(host_t* host, GOutputStream* ostr);
 
-host_t* get_host(GList** queue, uint8_t num);
-void    print_host_load(GTree* host_list, GOutputStream* ostr);
+host_t* get_host(GQueue* queue, uint8_t num);
+void    print_host_load(GHashTable* host_list, GOutputStream* ostr);
 
 #endif /* HOST_H_INCLUDE */
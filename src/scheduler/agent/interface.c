@@ -106,6 +106,72 @@ static void interface_conn_destroy(interface_connection* inter)
   g_free(inter);
 }
 
+/**
+ * @brief The set of commands the interface understands.
+ */
+typedef enum
+{
+  CMD_UNKNOWN,
+  CMD_CLOSE,
+  CMD_STOP,
+  CMD_DIE,
+  CMD_LOAD,
+  CMD_KILL,
+  CMD_PAUSE,
+  CMD_RELOAD,
+  CMD_AGENTS,
+  CMD_STATUS,
+  CMD_RESTART,
+  CMD_VERBOSE,
+  CMD_PRIORITY,
+  CMD_DATABASE
+} interface_cmd;
+
+/**
+ * @brief Resolves a command word to its interface_cmd value.
+ *
+ * Dispatches on the first character so a command is matched with at
+ * most two string comparisons instead of being strcmp'd against every
+ * command in the list in turn.
+ *
+ * @param cmd the lower case command word sent by the interface
+ * @return the matching interface_cmd, CMD_UNKNOWN if there is none
+ */
+static interface_cmd interface_resolve_cmd(const char* cmd)
+{
+  switch(cmd[0])
+  {
+    case 'a':
+      return strcmp(cmd, "agents")   == 0 ? CMD_AGENTS   : CMD_UNKNOWN;
+    case 'c':
+      return strcmp(cmd, "close")    == 0 ? CMD_CLOSE    : CMD_UNKNOWN;
+    case 'd':
+      if(strcmp(cmd, "die")      == 0) return CMD_DIE;
+      if(strcmp(cmd, "database") == 0) return CMD_DATABASE;
+      return CMD_UNKNOWN;
+    case 'k':
+      return strcmp(cmd, "kill")     == 0 ? CMD_KILL     : CMD_UNKNOWN;
+    case 'l':
+      return strcmp(cmd, "load")     == 0 ? CMD_LOAD     : CMD_UNKNOWN;
+    case 'p':
+      if(strcmp(cmd, "pause")    == 0) return CMD_PAUSE;
+      if(strcmp(cmd, "priority") == 0) return CMD_PRIORITY;
+      return CMD_UNKNOWN;
+    case 'r':
+      if(strcmp(cmd, "reload")   == 0) return CMD_RELOAD;
+      if(strcmp(cmd, "restart")  == 0) return CMD_RESTART;
+      return CMD_UNKNOWN;
+    case 's':
+      if(strcmp(cmd, "stop")     == 0) return CMD_STOP;
+      if(strcmp(cmd, "status")   == 0) return CMD_STATUS;
+      return CMD_UNKNOWN;
+    case 'v':
+      return strcmp(cmd, "verbose")  == 0 ? CMD_VERBOSE  : CMD_UNKNOWN;
+    default:
+      return CMD_UNKNOWN;
+  }
+}
+
 /**
  * @brief Function that will run the thread associated with a particular interface
  * instance.
@@ -139,19 +205,22 @@ void interface_thread(interface_connection* conn, scheduler_t* scheduler)
   GMatchInfo* regex_match;
   job_t* job;
   char buffer[BUFFER_SIZE];
-  char org[sizeof(buffer)];
   char* arg1, * arg2, * arg3;
   char* cmd;
   arg_int* params;
   int i;
+  gssize nbytes;
+  interface_cmd command;
 
-  memset(buffer, '\0', sizeof(buffer));
-
-  while(g_input_stream_read(conn->istr, buffer, sizeof(buffer), scheduler->cancel, NULL) > 0)
+  while((nbytes = g_input_stream_read(conn->istr, buffer, sizeof(buffer) - 1,
+      scheduler->cancel, NULL)) > 0)
   {
+    /* terminate at the bytes actually received so that the tail of a
+     * previous, longer command cannot leak into this one */
+    buffer[nbytes] = '\0';
+
     V_INTERFACE("INTERFACE: received \"%s\"\n", buffer);
-    /* convert all characters before first ' ' to lower case */
-    memcpy(org, buffer, sizeof(buffer));
+    /* convert the command to lower case */
     for(cmd = buffer; *cmd; cmd++)
       *cmd = g_ascii_tolower(*cmd);
     g_regex_match(scheduler->parse_interface_cmd, buffer, 0, &regex_match);
@@ -171,12 +240,14 @@ void interface_thread(interface_connection* conn, scheduler_t* scheduler)
     V_INTERFACE("INTERFACE: send \"received\"\n");
     g_output_stream_write(conn->ostr, "received\n", 9, NULL, NULL);
 
+    command = interface_resolve_cmd(cmd);
+
     /* command: "close"
      *
      * The interface has chosen to close the connection. Return the command
      * in acknowledgment of the command and end this thread.
      */
-    if(strcmp(cmd, "close") == 0)
+    if(command == CMD_CLOSE)
     {
       g_output_stream_write(conn->ostr, "CLOSE\n", 6, NULL, NULL);
       V_INTERFACE("INTERFACE: closing connection to user interface\n");
@@ -192,7 +263,7 @@ void interface_thread(interface_connection* conn, scheduler_t* scheduler)
      * scheduler will wait for all currently executing agents to finish
      * running, then exit the vent loop.
      */
-    else if(strcmp(cmd, "stop") == 0)
+    else if(command == CMD_STOP)
     {
       g_output_stream_write(conn->ostr, "CLOSE\n", 6, NULL, NULL);
       V_INTERFACE("INTERFACE: shutting down scheduler gracefully\n");
@@ -209,7 +280,7 @@ void interface_thread(interface_connection* conn, scheduler_t* scheduler)
      * should acknowledge the command and proceed to kill all current executing
      * agents and exit the event loop
      */
-    else if(strcmp(cmd, "die") == 0)
+    else if(command == CMD_DIE)
     {
       g_output_stream_write(conn->ostr, "CLOSE\n", 6, NULL, NULL);
       V_INTERFACE("INTERFACE: killing the scheduler\n");
@@ -226,7 +297,7 @@ void interface_thread(interface_connection* conn, scheduler_t* scheduler)
      * hosts are under. The scheduler should respond with the status of all the
      * hosts.
      */
-    else if(strcmp(cmd, "load") == 0)
+    else if(command == CMD_LOAD)
     {
       print_host_load(scheduler->host_list, conn->ostr);
     }
@@ -240,7 +311,7 @@ void interface_thread(interface_connection* conn, scheduler_t* scheduler)
      * message: A message that will be in the email notification and the
      *          jq_endtext field of the job queue
      */
-    else if(strcmp(cmd, "kill") == 0)
+    else if(command == CMD_KILL)
     {
       arg1 = g_match_info_fetch(regex_match, 3);
       arg2 = g_match_info_fetch(regex_match, 8);
@@ -276,7 +347,7 @@ void interface_thread(interface_connection* conn, scheduler_t* scheduler)
      * to free up resources on a particular host. The argument is required and
      * is the jq_pk for the job that needs to be paused.
      */
-    else if(strcmp(cmd, "pause") == 0)
+    else if(command == CMD_PAUSE)
     {
       arg1 = g_match_info_fetch(regex_match, 3);
 
@@ -303,7 +374,7 @@ void interface_thread(interface_connection* conn, scheduler_t* scheduler)
      * be used if a change to an agent or fossology.conf has been made since
      * the scheduler started running.
      */
-    else if(strcmp(cmd, "reload") == 0)
+    else if(command == CMD_RELOAD)
     {
       event_signal(scheduler_config_event, NULL);
     }
@@ -313,7 +384,7 @@ void interface_thread(interface_connection* conn, scheduler_t* scheduler)
      * The interface has requested a list of agents that the scheduler is able
      * to run correctly.
      */
-    else if(strcmp(cmd, "agents") == 0)
+    else if(command == CMD_AGENTS)
     {
       event_signal(list_agents_event, conn->ostr);
     }
@@ -328,7 +399,7 @@ void interface_thread(interface_connection* conn, scheduler_t* scheduler)
      * without job_id:
      *   print scheduler statsu followed by status of every job
      */
-    else if(strcmp(cmd, "status") == 0)
+    else if(command == CMD_STATUS)
     {
       arg1 = g_match_info_fetch(regex_match, 3);
 
@@ -346,7 +417,7 @@ void interface_thread(interface_connection* conn, scheduler_t* scheduler)
      * paused. The argument for this command is required and is the jq_pk for
      * the job that should be restarted.
      */
-    else if(strcmp(cmd, "restart") == 0)
+    else if(command == CMD_RESTART)
     {
       arg1 = g_match_info_fetch(regex_match, 3);
 
@@ -380,7 +451,7 @@ void interface_thread(interface_connection* conn, scheduler_t* scheduler)
      *  2 arguments: change the verbose level of the job with the jq_pk of the
      *               first arguement to the second argument
      */
-    else if(strcmp(cmd, "verbose") == 0)
+    else if(command == CMD_VERBOSE)
     {
       arg1 = g_match_info_fetch(regex_match, 3);
       arg2 = g_match_info_fetch(regex_match, 5);
@@ -431,7 +502,7 @@ void interface_thread(interface_connection* conn, scheduler_t* scheduler)
      * systems priority of the relevant job and change the priority of the job
      * in the database to match. Both arguments are required for this command.
      */
-    else if(strcmp(cmd, "priority") == 0)
+    else if(command == CMD_PRIORITY)
     {
       arg1 = g_match_info_fetch(regex_match, 3);
       arg2 = g_match_info_fetch(regex_match, 5);
@@ -466,9 +537,9 @@ void interface_thread(interface_connection* conn, scheduler_t* scheduler)
      * The scheduler should check the database. This will normaly be sent by
      * the ui when a new job has been queue and must be run.
      */
-    else if(strcmp(cmd, "database") == 0)
+    else if(command == CMD_DATABASE)
     {
-      event_signal(database_update_event, NULL);
+      database_update_request();
     }
 
     /* command: unknown
@@ -486,7 +557,6 @@ void interface_thread(interface_connection* conn, scheduler_t* scheduler)
 
     g_match_info_free(regex_match);
     g_free(cmd);
-    memset(buffer, '\0', sizeof(buffer));
   }
 
   interface_conn_destroy(conn);
@@ -69,7 +69,7 @@ static void log_event(scheduler_t* scheduler, log_event_args* pass)
 {
   lprintf(pass->log, "%s", pass->msg);
   g_free(pass->msg);
-  g_free(pass);
+  g_slice_free(log_event_args, pass);
 }
 
 /* ************************************************************************** */
@@ -290,7 +290,7 @@ int clprintf(log_t* log, char* s_name, uint16_t s_line, const char* fmt, ...)
   va_start(args, fmt);
   if(g_thread_self() != main_thread)
   {
-    pass = g_new0(log_event_args, 1);
+    pass = g_slice_new0(log_event_args);
     pass->log = log;
     pass->msg = g_strdup_vprintf(fmt, args);
     event_signal_ext(log_event, pass, "log_event", s_name, s_line);
@@ -30,6 +30,8 @@ with this program; if not, write to the Free Software Foundation, Inc.,
 #include <fossconfig.h>
 
 /* std library includes */
+#include <ctype.h>
+#include <stdatomic.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -37,8 +39,10 @@ with this program; if not, write to the Free Software Foundation, Inc.,
 /* unix system includes */
 #include <dirent.h>
 #include <fcntl.h>
+#include <sys/file.h>
 #include <signal.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
 #include <sys/types.h>
 #include <sys/wait.h>
 #include <unistd.h>
@@ -84,7 +88,7 @@ CONF_VARIABLES_TYPES(SELECT_DECLS)
 #define MASK_SIGQUIT (1 << 3)
 #define MASK_SIGHUP  (1 << 4)
 
-int sigmask = 0;
+_Atomic int sigmask = 0;
 
 /**
  * @brief Handles any signals sent to the scheduler that are not SIGCHLD.
@@ -103,36 +107,20 @@ int sigmask = 0;
  */
 void scheduler_sig_handle(int signo)
 {
-  /* Anywhere you see a "#if __GNUC__" the code is checking if GCC is the
-   * compiler. This is because the __sync... set of functions are the GCC
-   * version of atomics.
-   *
-   * This means that if you aren't compiling with GCC, you can have a race
-   * condition that results in a signal being lost during the
-   * signal_scheduler() function.
-   *
-   * What could happen:
-   *   1. signal_scheduler() reads value of sigmask
-   *   2. scheduler receives a SIG**** and sets the correct bit in sigmask
-   *   3. signal_scheduler() clears sigmask by setting it to 0
-   *
-   * In this set of events, a signal has been lost. If this is a sigchld this
-   * could be very bad as a job could never get marked as finished.
+  /* sigmask is set here in the signal handler and consumed by
+   * scheduler_signal() on the event loop thread, so both sides must
+   * access it atomically or a signal could be lost between the read
+   * and the clear in scheduler_signal(). The C11 atomics are portable,
+   * unlike the GCC __sync builtins used previously, and a relaxed
+   * fetch-or is all a lone flag bit needs.
    */
   switch(signo)
   {
-#if __GNUC__
-    case SIGCHLD: __sync_fetch_and_or(&sigmask, MASK_SIGCHLD); break;
-    case SIGTERM: __sync_fetch_and_or(&sigmask, MASK_SIGTERM); break;
-    case SIGQUIT: __sync_fetch_and_or(&sigmask, MASK_SIGQUIT); break;
-    case SIGHUP:  __sync_fetch_and_or(&sigmask, MASK_SIGHUP);  break;
-#else
-    case SIGCHLD: sigmask |= MASK_SIGCHLD; break;
-    case SIGALRM: sigmask |= MASK_SIGALRM; break;
-    case SIGTERM: sigmask |= MASK_SIGTERM; break;
-    case SIGQUIT: sigmask |= MASK_SIGQUIT; break;
-    case SIGHUP:  sigmask |= MASK_SIGHUP ; break;
-#endif
+    case SIGCHLD: atomic_fetch_or_explicit(&sigmask, MASK_SIGCHLD, memory_order_relaxed); break;
+    case SIGALRM: atomic_fetch_or_explicit(&sigmask, MASK_SIGALRM, memory_order_relaxed); break;
+    case SIGTERM: atomic_fetch_or_explicit(&sigmask, MASK_SIGTERM, memory_order_relaxed); break;
+    case SIGQUIT: atomic_fetch_or_explicit(&sigmask, MASK_SIGQUIT, memory_order_relaxed); break;
+    case SIGHUP:  atomic_fetch_or_explicit(&sigmask, MASK_SIGHUP,  memory_order_relaxed); break;
   }
 }
 
@@ -158,17 +146,16 @@ void scheduler_signal(scheduler_t* scheduler)
   // copy of the mask
   guint mask;
 
+  // current time, taken once per call
+  time_t now;
+
   /* this will get sigmask and set it to 0 */
-#if __GNUC__
-  mask = __sync_fetch_and_and(&sigmask, 0);
-#else
-  mask = sigmask;
-  sigmask = 0;
-#endif
+  mask = atomic_exchange_explicit(&sigmask, 0, memory_order_acquire);
 
   /* initialize last_update */
+  now = time(NULL);
   if(last_update == 0)
-    last_update = time(NULL);
+    last_update = now;
 
   /* signal: SIGCHLD
    *
@@ -179,17 +166,14 @@ void scheduler_signal(scheduler_t* scheduler)
   if(mask & MASK_SIGCHLD)
   {
     pid_t n;          // the next pid that has died
-    pid_t* pass;
     int status;       // status returned by waitpit()
 
-    /* get all of the dead children's pids */
+    /* get all of the dead children's pids. The pid and status travel
+     * with the event in the form built by agent_pack_death_event(). */
     while((n = waitpid(-1, &status, WNOHANG)) > 0)
     {
       V_SCHED("SIGNALS: received sigchld for pid %d\n", n);
-      pass = g_new0(pid_t, 2);
-      pass[0] = n;
-      pass[1] = status;
-      event_signal(agent_death_event, pass);
+      event_signal(agent_death_event, agent_pack_death_event(n, status));
     }
   }
 
@@ -218,13 +202,15 @@ void scheduler_signal(scheduler_t* scheduler)
 
   /* signal: SIGHUP
    *
-   * A SIGHUP has been received. reload the configuration files for the
-   * scheduler. This will run here instead of being queued as an event.
+   * A SIGHUP has been received. Queue a scheduler_config_event so the
+   * reload runs as a normal event on the main loop, the same way the
+   * interface "reload" command does, instead of being wedged into the
+   * signal handling path.
    */
   if(mask & MASK_SIGHUP)
   {
     V_SCHED("SIGNALS: Scheduler received SGIHUP, reloading configuration data\n");
-    scheduler_config_event(scheduler, NULL);
+    event_signal(scheduler_config_event, NULL);
   }
 
   /* Finish by checking if an agent update needs to be performed.
@@ -234,12 +220,12 @@ void scheduler_signal(scheduler_t* scheduler)
    * agents. The database is updated to make sure that a new job hasn't been
    * scheduled without the scheduler being informed.
    */
-  if((time(NULL) - last_update) > CONF_agent_update_interval )
+  if((now - last_update) > CONF_agent_update_interval )
   {
     V_SPECIAL("SIGNALS: Performing agent and database update\n");
     event_signal(agent_update_event, NULL);
-    event_signal(database_update_event, NULL);
-    last_update = time(NULL);
+    database_update_request();
+    last_update = now;
   }
 }
 
@@ -269,10 +255,11 @@ scheduler_t* scheduler_init(gchar* sysconfigdir, log_t* log)
 
   ret->sysconfig     = NULL;
   ret->sysconfigdir  = g_strdup(sysconfigdir);
-  ret->logdir        = LOG_DIR;
+  ret->logdir        = g_strdup(LOG_DIR);
   ret->logcmdline    = FALSE;
+  ret->logopened     = FALSE;
   ret->main_log      = log;
-  ret->host_queue    = NULL;
+  ret->host_queue    = g_queue_new();
 
   ret->i_created     = FALSE;
   ret->i_terminate   = FALSE;
@@ -290,22 +277,6 @@ scheduler_t* scheduler_init(gchar* sysconfigdir, log_t* log)
   ret->email_footer  = NULL;
   ret->email_command = NULL;
 
-  /* This regex should find:
-   *   1. One or more capital letters followed by a ':' followed by white space,
-   *      followed by a number
-   *   2. One or more capital letters followed by a ':' followed by white space,
-   *      followed by a number, followed by white space, followed by a number
-   *
-   * Examples:
-   *   HEART: 1 2   -> matches
-   *   HEART: 1     -> matches
-   *   HEART:       -> does not match
-   *
-   */
-  ret->parse_agent_msg = g_regex_new(
-      "([A-Z]+):([ \t]+)(\\d+)(([ \t]+)(\\d))?",
-      0, 0, NULL);
-
   /* This regex should find:
    *   1. A '$' followed by any combination of capital letters or underscore
    *   2. A '$' followed by any combination of capital letters or underscore,
@@ -321,7 +292,7 @@ scheduler_t* scheduler_init(gchar* sysconfigdir, log_t* log)
    */
   ret->parse_db_email      = g_regex_new(
       "\\$([A-Z_]*)(\\.([a-zA-Z_]*)\\.([a-zA-Z_]*))?",
-      0, 0, NULL);
+      G_REGEX_OPTIMIZE, 0, NULL);
 
   /* This regex should match:
    *   1. a set of alphabetical characters
@@ -343,13 +314,13 @@ scheduler_t* scheduler_init(gchar* sysconfigdir, log_t* log)
    */
   ret->parse_interface_cmd = g_regex_new(
       "(\\w+)(\\s+(-?\\d+))?(\\s+((-?\\d+)|(\"(.*)\")))?",
-      0, G_REGEX_MATCH_NEWLINE_LF, NULL);
+      G_REGEX_OPTIMIZE, G_REGEX_MATCH_NEWLINE_LF, NULL);
 
-  ret->meta_agents = g_tree_new_full(string_compare, NULL, NULL,
+  ret->meta_agents = g_hash_table_new_full(g_str_hash, g_str_equal, NULL,
       (GDestroyNotify)meta_agent_destroy);
-  ret->agents      = g_tree_new_full(int_compare,    NULL, NULL,
+  ret->agents      = g_hash_table_new_full(g_direct_hash, NULL, NULL,
       (GDestroyNotify)agent_destroy);
-  ret->host_list = g_tree_new_full(string_compare, NULL, NULL,
+  ret->host_list = g_hash_table_new_full(g_str_hash, g_str_equal, NULL,
       (GDestroyNotify)host_destroy);
   ret->job_list     = g_tree_new_full(int_compare, NULL, NULL,
       (GDestroyNotify)job_destroy);
@@ -382,9 +353,10 @@ void scheduler_destroy(scheduler_t* scheduler)
   }
 
   if(scheduler->process_name) g_free(scheduler->process_name);
+  if(scheduler->logdir)       g_free(scheduler->logdir);
   if(scheduler->sysconfig)    fo_config_free(scheduler->sysconfig);
   if(scheduler->sysconfigdir) g_free(scheduler->sysconfigdir);
-  if(scheduler->host_queue)   g_list_free(scheduler->host_queue);
+  if(scheduler->host_queue)   g_queue_free(scheduler->host_queue);
   if(scheduler->workers)      g_thread_pool_free(scheduler->workers, FALSE, TRUE);
 
   if(scheduler->email_subject) g_free(scheduler->email_subject);
@@ -392,13 +364,12 @@ void scheduler_destroy(scheduler_t* scheduler)
 
   g_sequence_free(scheduler->job_queue);
 
-  g_regex_unref(scheduler->parse_agent_msg);
   g_regex_unref(scheduler->parse_db_email);
   g_regex_unref(scheduler->parse_interface_cmd);
 
-  g_tree_unref(scheduler->meta_agents);
-  g_tree_unref(scheduler->agents);
-  g_tree_unref(scheduler->host_list);
+  g_hash_table_unref(scheduler->meta_agents);
+  g_hash_table_unref(scheduler->agents);
+  g_hash_table_unref(scheduler->host_list);
   g_tree_unref(scheduler->job_list);
 
   if (scheduler->db_conn) PQfinish(scheduler->db_conn);
@@ -429,13 +400,14 @@ void scheduler_update(scheduler_t* scheduler)
   static int lockout = 0;
 
   /* locals */
-  int n_agents = g_tree_nnodes(scheduler->agents);
+  int n_agents = g_hash_table_size(scheduler->agents);
   int n_jobs   = active_jobs(scheduler->job_list);
+  meta_agent_t* ma;
 
   /* check to see if we are in and can exit the startup state */
   if(scheduler->s_startup && n_agents == 0)
   {
-    event_signal(database_update_event, NULL);
+    database_update_request();
     scheduler->s_startup = 0;
   }
 
@@ -453,11 +425,13 @@ void scheduler_update(scheduler_t* scheduler)
   {
     while((job = peek_job(scheduler->job_queue)) != NULL)
     {
+      /* look the meta agent up once per job instead of once per check */
+      ma = g_hash_table_lookup(scheduler->meta_agents, job->agent_type);
+
       // check if the agent is required to run on local host
-      if(is_meta_special(
-          g_tree_lookup(scheduler->meta_agents, job->agent_type), SAG_LOCAL))
+      if(is_meta_special(ma, SAG_LOCAL))
       {
-        host = g_tree_lookup(scheduler->host_list, LOCAL_HOST);
+        host = g_hash_table_lookup(scheduler->host_list, LOCAL_HOST);
         if(!(host->running < host->max))
         {
           job = NULL;
@@ -467,7 +441,7 @@ void scheduler_update(scheduler_t* scheduler)
       // check if the job is required to run on a specific machine
       else if((job->required_host != NULL))
       {
-        host = g_tree_lookup(scheduler->host_list, job->required_host);
+        host = g_hash_table_lookup(scheduler->host_list, job->required_host);
         if(host != NULL)
         {
           if(!(host->running < host->max))
@@ -485,15 +459,14 @@ void scheduler_update(scheduler_t* scheduler)
        }
       }
       // the generic case, this can run anywhere, find a place
-      else if((host = get_host(&(scheduler->host_queue), 1)) == NULL)
+      else if((host = get_host(scheduler->host_queue, 1)) == NULL)
       {
         job = NULL;
         break;
       }
 
       next_job(scheduler->job_queue);
-      if(is_meta_special(
-          g_tree_lookup(scheduler->meta_agents, job->agent_type), SAG_EXCLUSIVE))
+      if(is_meta_special(ma, SAG_EXCLUSIVE))
       {
         V_SCHED("JOB_INIT: exclusive, postponing initialization\n");
         break;
@@ -542,12 +515,20 @@ void set_usr_grp(gchar* process_name, fo_conf* config)
   struct group*  grp;
   struct passwd* pwd;
 
-  char* group =
-      fo_config_has_key(config, GU_HEADER, GU_GROUP) ?
-      fo_config_get    (config, GU_HEADER, GU_GROUP, NULL) : PROJECT_GROUP;
-  char* user  =
-      fo_config_has_key(config, GU_HEADER, GU_USER)  ?
-      fo_config_get    (config, GU_HEADER, GU_USER, NULL)  : PROJECT_USER;
+  /* once the credentials have been dropped they cannot change again, so
+   * the NSS lookups and the setgid/setuid dance only need to happen on
+   * the first call; every config reload after that would repeat the same
+   * group/passwd queries (which can hit LDAP/NIS) for the same answer */
+  static gboolean creds_set = FALSE;
+
+  if(creds_set)
+    return;
+
+  char* group = fo_config_get(config, GU_HEADER, GU_GROUP, NULL);
+  char* user  = fo_config_get(config, GU_HEADER, GU_USER,  NULL);
+
+  if(group == NULL) group = PROJECT_GROUP;
+  if(user  == NULL) user  = PROJECT_USER;
 
   /* make sure group exists */
   grp = getgrnam(group);
@@ -589,59 +570,105 @@ void set_usr_grp(gchar* process_name, fo_conf* config)
         strerror(errno));
     exit(-1);
   }
+
+  creds_set = TRUE;
+}
+
+/**
+ * @brief Builds the path of the file that holds the scheduler pid
+ *
+ * @param sysconfigdir  the directory containing fossology.conf
+ * @return the path of the pid file, must be g_free()'d by the caller
+ */
+static gchar* scheduler_pid_path(const gchar* sysconfigdir)
+{
+  return g_strdup_printf("%s/fossology.pid", sysconfigdir);
+}
+
+/**
+ * @brief Records the pid of this scheduler in the pid file
+ *
+ * The file descriptor stays open for the lifetime of the process so the
+ * flock() taken here is held until the scheduler exits, however it
+ * exits. kill_scheduler() uses the lock to tell a live scheduler from a
+ * stale pid file.
+ *
+ * @param scheduler  the scheduler to write the pid for
+ */
+void scheduler_register_pid(scheduler_t* scheduler)
+{
+  gchar* pid_path = scheduler_pid_path(scheduler->sysconfigdir);
+  int fd = open(pid_path, O_RDWR | O_CREAT, 0644);
+
+  if(fd == -1)
+  {
+    WARNING("unable to open pid file: %s", pid_path);
+    g_free(pid_path);
+    return;
+  }
+
+  if(flock(fd, LOCK_EX | LOCK_NB) != 0)
+  {
+    WARNING("another scheduler holds the pid file: %s", pid_path);
+    close(fd);
+    g_free(pid_path);
+    return;
+  }
+
+  if(ftruncate(fd, 0) != 0 || dprintf(fd, "%d\n", scheduler->s_pid) < 0)
+    WARNING("unable to write pid to pid file: %s", pid_path);
+
+  /* fd is intentionally left open to keep the lock */
+  g_free(pid_path);
 }
 
 /**
- * @brief Kills all other running scheduler
- * @param force  if the scheduler should shutdown gracefully
+ * @brief Kills the running scheduler
+ * @param force         if the scheduler should shutdown gracefully
+ * @param sysconfigdir  the directory containing fossology.conf
  * @return 0 for success (i.e. a scheduler was killed), -1 for failure.
  *
- * This uses the /proc file system to find all processes that have fo_scheduler
- * in the name and sends a kill signal to them.
+ * This reads the pid file written by scheduler_register_pid() and sends
+ * the signal to that pid. The flock() held by a running scheduler
+ * distinguishes a live scheduler from a pid file left behind by a
+ * crash, so no scan over /proc is needed.
  */
-int kill_scheduler(int force)
+int kill_scheduler(int force, gchar* sysconfigdir)
 {
-  gchar f_name[FILENAME_MAX];
-  struct dirent* ep;
-  DIR* dp;
+  gchar* pid_path = scheduler_pid_path(sysconfigdir);
   FILE* file;
-  gint num_killed = 0;
-  pid_t s_pid = getpid();
+  int pid = 0;
 
-  if((dp = opendir("/proc/")) == NULL)
+  if((file = fopen(pid_path, "r")) == NULL)
   {
-    fprintf(stderr, "ERROR %s.%d: Could not open /proc/ file system\n",
-        __FILE__, __LINE__);
-    exit(-1);
+    fprintf(stderr, "ERROR %s.%d: Could not open pid file %s\n",
+        __FILE__, __LINE__, pid_path);
+    g_free(pid_path);
+    return -1;
   }
 
-  while((ep = readdir(dp)) != NULL)
+  if(flock(fileno(file), LOCK_EX | LOCK_NB) == 0)
   {
-    if(string_is_num(ep->d_name))
-    {
-      snprintf(f_name, sizeof(f_name), "/proc/%s/cmdline", ep->d_name);
-      if((file = fopen(f_name, "rt")))
-      {
-        if(fgets(f_name, sizeof(f_name), file) != NULL &&
-            strstr(f_name, "fo_scheduler") && s_pid != atoi(ep->d_name))
-        {
-          NOTIFY("KILL: send signal to process %s\n", ep->d_name);
-          if(force)
-            kill(atoi(ep->d_name), SIGQUIT);
-          else
-            kill(atoi(ep->d_name), SIGTERM);
-          num_killed++;
-        }
+    /* nobody holds the lock, so no scheduler is running */
+    fclose(file);
+    g_free(pid_path);
+    return -1;
+  }
 
-        fclose(file);
-      }
-    }
+  if(fscanf(file, "%d", &pid) != 1 || pid <= 0 || pid == getpid())
+  {
+    fprintf(stderr, "ERROR %s.%d: Invalid pid in pid file %s\n",
+        __FILE__, __LINE__, pid_path);
+    fclose(file);
+    g_free(pid_path);
+    return -1;
   }
 
-  closedir(dp);
+  NOTIFY("KILL: send signal to process %d\n", pid);
+  kill(pid, force ? SIGQUIT : SIGTERM);
 
-  if(num_killed == 0)
-    return -1;
+  fclose(file);
+  g_free(pid_path);
   return 0;
 }
 
@@ -652,25 +679,23 @@ int kill_scheduler(int force)
  */
 void scheduler_clear_config(scheduler_t* scheduler)
 {
-  g_tree_clear(scheduler->meta_agents);
-  g_tree_clear(scheduler->host_list);
+  g_hash_table_remove_all(scheduler->meta_agents);
+  g_hash_table_remove_all(scheduler->host_list);
 
-  g_list_free(scheduler->host_queue);
-  scheduler->host_queue = NULL;
+  g_queue_clear(scheduler->host_queue);
 
   g_free(scheduler->host_url);
   g_free(scheduler->email_subject);
   g_free(scheduler->email_command);
-  PQfinish(scheduler->db_conn);
-  scheduler->db_conn       = NULL;
+  /* the database connection is intentionally kept open: connecting is
+   * expensive and database_init() reuses a healthy connection across
+   * configuration reloads */
   scheduler->host_url      = NULL;
   scheduler->email_subject = NULL;
   scheduler->email_command = NULL;
 
-  if(scheduler->default_header)
-    munmap(scheduler->email_header, strlen(scheduler->email_header));
-  if(scheduler->default_footer)
-    munmap(scheduler->email_footer, strlen(scheduler->email_footer));
+  /* the email template mappings are owned by the cache in email_init(),
+   * so only the references are dropped here */
   scheduler->email_header  = NULL;
   scheduler->email_footer  = NULL;
 
@@ -679,148 +704,239 @@ void scheduler_clear_config(scheduler_t* scheduler)
 }
 
 /**
- * @brief GTraverseFunc used by g_tree_clear to collect all the keys in a tree
+ * @brief A single agent configuration file, loaded by the parse pool.
  *
- * @param key    The current key
- * @param value  The value mapped to the current key
- * @param data   A GList** that the key will be appended to
- * @return       Always returns 0
+ * The expensive part of loading the agent configurations is reading and
+ * parsing the individual agent.conf files. These are independent of each
+ * other, so they are parsed by a small thread pool while the results are
+ * processed sequentially on the main thread.
  */
-static gboolean g_tree_collect(gpointer key, gpointer value, gpointer data)
+typedef struct
 {
-  GList** ret = (GList**)data;
+  gchar*   name;     ///< the name of the agent, the directory entry name
+  gchar*   dirname;  ///< the full path of the configuration file
+  fo_conf* config;   ///< the parsed configuration, NULL if the load failed
+  GError*  error;    ///< error reported by fo_config_load
+} agent_conf_task;
 
-  *ret = g_list_append(*ret, key);
+/**
+ * An in-flight batch of agent configuration parses, created by
+ * scheduler_agent_config_start() and consumed by
+ * scheduler_agent_config_finish().
+ */
+struct agent_conf_batch
+{
+  GThreadPool* pool;  ///< the pool parsing the configuration files
+  GPtrArray*   tasks; ///< one task per agent configuration file
+};
 
-  return 0;
+/**
+ * @brief GFunc that parses one agent configuration file.
+ *
+ * This runs in the parse pool and only touches the task it is handed, so
+ * no locking is needed; all logging and table inserts happen afterwards
+ * on the main thread.
+ *
+ * @param task    the agent configuration file to parse
+ * @param unused  needed by the GFunc signature, not used
+ */
+static void scheduler_agent_config_load(agent_conf_task* task, gpointer unused)
+{
+  task->config = fo_config_load(task->dirname, &task->error);
 }
 
 /**
- * @brief Clears the contents of a GTree
+ * @brief Starts the parse pool for the agent configuration files.
+ *
+ * This lists the mods-enabled directory and queues one parse task per
+ * agent on the pool. The caller is free to do independent work, such as
+ * establishing the database connection, while the files are parsed, and
+ * must then hand the returned batch to scheduler_agent_config_finish().
  *
- * @param tree  the tree to remove all elements from
+ * @param scheduler  the scheduler to load the configuration for
+ * @return the in-flight batch, NULL if the directory could not be opened
  */
-void g_tree_clear(GTree* tree)
+agent_conf_batch* scheduler_agent_config_start(scheduler_t* scheduler)
 {
-  GList* keys = NULL;
-  GList* iter = NULL;
+  DIR* dp;                  // directory pointer used to load meta agents;
+  struct dirent* ep;        // information about directory
+  gchar* dirname;           // holds the name of the current configuration file
+  agent_conf_task* task;
+  agent_conf_batch* batch;
 
-  g_tree_foreach(tree, g_tree_collect, &keys);
+  dirname = g_strdup_printf("%s/%s/", scheduler->sysconfigdir, AGENT_CONF);
+  if((dp = opendir(dirname)) == NULL)
+  {
+    FATAL("Could not open agent config directory: %s", dirname);
+    return NULL;
+  }
+  g_free(dirname);
 
-  for(iter = keys; iter != NULL; iter = iter->next)
-    g_tree_remove(tree, iter->data);
+  /* parse the configuration files in parallel, the results are handled
+   * in scheduler_agent_config_finish() in the order they were listed */
+  batch = g_new0(agent_conf_batch, 1);
+  batch->tasks = g_ptr_array_new();
+  batch->pool = g_thread_pool_new((GFunc)scheduler_agent_config_load, NULL,
+      AGENT_CONF_THREADS, FALSE, NULL);
 
-  g_list_free(keys);
+  while((ep = readdir(dp)) != NULL)
+  {
+    if(ep->d_name[0] != '.')
+    {
+      task = g_new0(agent_conf_task, 1);
+      task->name    = g_strdup(ep->d_name);
+      task->dirname = g_strdup_printf("%s/%s/%s/%s.conf",
+          scheduler->sysconfigdir, AGENT_CONF, ep->d_name, ep->d_name);
+
+      g_ptr_array_add(batch->tasks, task);
+      g_thread_pool_push(batch->pool, task, NULL);
+    }
+  }
+
+  closedir(dp);
+  return batch;
 }
 
 /**
- * @brief Loads a particular agents configuration file
+ * @brief Waits for the parse pool and creates the meta agents.
  *
- * This loads and saves the results as a new meta_agent. This assumes that the
- * configuration file for the agent includes the following key/value pairs:
- * -# command: The command that will be used to start the agent
- * -# max:     The maximum number of this agent that can run at once
- * -# special: Anything that is special about the agent
+ * The meta agent inserts and all logging happen here on the calling
+ * thread, so the workers never need to take a lock.
+ *
+ * @param scheduler  the scheduler to load the configuration for
+ * @param batch      the batch returned by scheduler_agent_config_start()
  */
-void scheduler_agent_config(scheduler_t* scheduler)
+void scheduler_agent_config_finish(scheduler_t* scheduler,
+    agent_conf_batch* batch)
 {
-  DIR* dp;                  // directory pointer used to load meta agents;
-  struct dirent* ep;        // information about directory
   gchar* dirname;           // holds the name of the current configuration file
   uint8_t max = -1;         // the number of agents to a host or number of one type running
   uint32_t special = 0;     // anything that is special about the agent (EXCLUSIVE)
+  int32_t special_len;      // the number of entries in the special list
   int32_t i;
   gchar* name;
   gchar* cmd;
   gchar* tmp;
   GError* error = NULL;
   fo_conf* config;
+  agent_conf_task* task;
+  guint t;
 
-  dirname = g_strdup_printf("%s/%s/", scheduler->sysconfigdir, AGENT_CONF);
-  if((dp = opendir(dirname)) == NULL)
-  {
-    FATAL("Could not open agent config directory: %s", dirname);
+  if(batch == NULL)
     return;
-  }
-  g_free(dirname);
+
+  g_thread_pool_free(batch->pool, FALSE, TRUE);
 
   /* load the configuration for the agents */
-  while((ep = readdir(dp)) != NULL)
+  for(t = 0; t < batch->tasks->len; t++)
   {
-    if(ep->d_name[0] != '.')
-    {
-      dirname = g_strdup_printf("%s/%s/%s/%s.conf",
-          scheduler->sysconfigdir, AGENT_CONF, ep->d_name, ep->d_name);
+    task    = g_ptr_array_index(batch->tasks, t);
+    dirname = task->dirname;
+    config  = task->config;
+    error   = task->error;
 
-      config = fo_config_load(dirname, &error);
-      if(error && error->code == fo_missing_file)
-      {
-        V_SCHED("CONFIG: Could not find %s\n", dirname);
-        g_clear_error(&error);
-        continue;
-      }
-      TEST_ERROR(error, "no additional info");
-      V_SCHED("CONFIG: loading config file %s\n", dirname);
+    if(error && error->code == fo_missing_file)
+    {
+      V_SCHED("CONFIG: Could not find %s\n", dirname);
+      g_clear_error(&error);
+      continue;
+    }
+    TEST_ERROR(error, "no additional info");
+    V_SCHED("CONFIG: loading config file %s\n", dirname);
 
-      if(!fo_config_has_group(config, "default"))
-      {
-        log_printf("ERROR: %s must have a \"default\" group\n", dirname);
-        log_printf("ERROR: cause by %s.%d\n", __FILE__, __LINE__);
-        continue;
-      }
+    if(!fo_config_has_group(config, "default"))
+    {
+      log_printf("ERROR: %s must have a \"default\" group\n", dirname);
+      log_printf("ERROR: cause by %s.%d\n", __FILE__, __LINE__);
+      continue;
+    }
 
-      special = 0;
-      name = ep->d_name;
-      max = fo_config_list_length(config, "default", "special", &error);
-      TEST_ERROR(error, "%s: the special key should be of type list", dirname);
-      for(i = 0; i < max; i++)
-      {
-        cmd = fo_config_get_list(config, "default", "special", i, &error);
-        TEST_ERROR(error, "%s: failed to load element %d of special list",
-            dirname, i)
-
-        if(cmd[0] != '\0') {
-          if(strncmp(cmd, "EXCLUSIVE", 9) == 0)
-            special |= SAG_EXCLUSIVE;
-          else if(strncmp(cmd, "NOEMAIL", 7) == 0)
-            special |= SAG_NOEMAIL;
-          else if(strncmp(cmd, "NOKILL", 6) == 0)
-            special |= SAG_NOKILL;
-          else if(strncmp(cmd, "LOCAL", 6) == 0)
-            special |= SAG_LOCAL;
-          else if(strlen(cmd) != 0)
-            WARNING("%s: Invalid special type for agent %s: %s",
-                dirname, name, cmd);
+    special = 0;
+    name = task->name;
+    special_len = fo_config_list_length(config, "default", "special", &error);
+    TEST_ERROR(error, "%s: the special key should be of type list", dirname);
+    for(i = 0; i < special_len; i++)
+    {
+      cmd = fo_config_get_list(config, "default", "special", i, &error);
+      TEST_ERROR(error, "%s: failed to load element %d of special list",
+          dirname, i)
+
+      if(cmd[0] != '\0') {
+        /* the token names all have distinct lengths, so the length picks
+         * the table entry and a single memcmp confirms it */
+        static const struct { const char* name; uint8_t len; uint32_t bit; }
+          sag_table[] = {
+            { "EXCLUSIVE", 9, SAG_EXCLUSIVE },
+            { "NOEMAIL",   7, SAG_NOEMAIL   },
+            { "NOKILL",    6, SAG_NOKILL    },
+            { "LOCAL",     5, SAG_LOCAL     } };
+        size_t k;
+
+        for(k = 0; k < sizeof(sag_table)/sizeof(sag_table[0]); k++)
+        {
+          if(strncmp(cmd, sag_table[k].name, sag_table[k].len) == 0)
+          {
+            special |= sag_table[k].bit;
+            break;
+          }
         }
-      }
-
-      cmd  = fo_config_get(config, "default", "command", &error);
-      TEST_ERROR(error, "%s: the default group must have a command key", dirname);
-      tmp  = fo_config_get(config, "default", "max", &error);
-      TEST_ERROR(error, "%s: the default group must have a max key", dirname);
 
-      if(!add_meta_agent(scheduler->meta_agents, name, cmd, (max = atoi(tmp)), special))
-      {
-        V_SCHED("CONFIG: could not create meta agent using %s\n", ep->d_name);
-      }
-      else if(TVERB_SCHED)
-      {
-        log_printf("CONFIG: added new agent\n");
-        log_printf("    name = %s\n", name);
-        log_printf(" command = %s\n", cmd);
-        log_printf("     max = %d\n", max);
-        log_printf(" special = %d\n", special);
+        if(k == sizeof(sag_table)/sizeof(sag_table[0]))
+          WARNING("%s: Invalid special type for agent %s: %s",
+              dirname, name, cmd);
       }
+    }
+
+    cmd  = fo_config_get(config, "default", "command", &error);
+    TEST_ERROR(error, "%s: the default group must have a command key", dirname);
+    tmp  = fo_config_get(config, "default", "max", &error);
+    TEST_ERROR(error, "%s: the default group must have a max key", dirname);
 
-      g_free(dirname);
-      fo_config_free(config);
+    max = atoi(tmp);
+    if(!add_meta_agent(scheduler->meta_agents, name, cmd, max, special))
+    {
+      V_SCHED("CONFIG: could not create meta agent using %s\n", name);
+    }
+    else if(TVERB_SCHED)
+    {
+      log_printf("CONFIG: added new agent\n"
+                 "    name = %s\n"
+                 " command = %s\n"
+                 "     max = %d\n"
+                 " special = %d\n",
+          name, cmd, max, special);
     }
+
+    fo_config_free(config);
   }
 
-  closedir(dp);
+  for(t = 0; t < batch->tasks->len; t++)
+  {
+    task = g_ptr_array_index(batch->tasks, t);
+    g_free(task->name);
+    g_free(task->dirname);
+    g_free(task);
+  }
+  g_ptr_array_free(batch->tasks, TRUE);
+  g_free(batch);
+
   event_signal(scheduler_test_agents, NULL);
 }
 
+/**
+ * @brief Loads a particular agents configuration file
+ *
+ * This loads and saves the results as a new meta_agent. This assumes that the
+ * configuration file for the agent includes the following key/value pairs:
+ * -# command: The command that will be used to start the agent
+ * -# max:     The maximum number of this agent that can run at once
+ * -# special: Anything that is special about the agent
+ */
+void scheduler_agent_config(scheduler_t* scheduler)
+{
+  scheduler_agent_config_finish(scheduler, scheduler_agent_config_start(scheduler));
+}
+
 /**
  * @brief Loads the configuration data from fossology.conf
  *
@@ -838,12 +954,15 @@ void scheduler_foss_config(scheduler_t* scheduler)
   gchar**  keys;                  // list of host names grabbed from the config file
   int32_t  max = -1;              // the number of agents to a host or number of one type running
   int32_t  special = 0;           // anything that is special about the agent (EXCLUSIVE)
-  gchar    addbuf[512];           // standard string buffer
-  gchar    dirbuf[FILENAME_MAX];  // standard string buffer
   GError*  error = NULL;          // error return location
   int32_t  i;                     // indexing variable
   host_t*  host;                  // new hosts will be created in the loop
-  fo_conf* version;               // information loaded from the version file
+  struct stat version_sb;         // used to check if the VERSION file changed
+  GString* conf_log;              // collects the config variable log lines
+
+  /* information loaded from the version file, cached across reloads */
+  static fo_conf* version = NULL;
+  static time_t version_mtime = 0;
 
   if(scheduler->sysconfig != NULL)
     fo_config_free(scheduler->sysconfig);
@@ -862,24 +981,42 @@ void scheduler_foss_config(scheduler_t* scheduler)
     scheduler->i_port = atoi(fo_config_get(scheduler->sysconfig,
         "FOSSOLOGY", "port", &error));
 
-  /* load the log directory */
+  /* load the log directory. The directory is duplicated because the config
+   * it comes from is freed on every reload, and the log is only reopened
+   * when the directory actually changed. */
   if(!scheduler->logcmdline)
   {
-    if(fo_config_has_key(scheduler->sysconfig, "DIRECTORIES", "LOGDIR"))
-      scheduler->logdir = fo_config_get(scheduler->sysconfig, "DIRECTORIES", "LOGDIR", &error);
-    scheduler->main_log = log_new(scheduler->logdir, NULL, scheduler->s_pid);
+    tmp = fo_config_get(scheduler->sysconfig, "DIRECTORIES", "LOGDIR", NULL);
+    if(tmp == NULL)
+      tmp = LOG_DIR;
 
-    if(main_log)
+    if(!scheduler->logopened || strcmp(scheduler->logdir, tmp) != 0)
     {
-      log_destroy(main_log);
-      main_log = scheduler->main_log;
+      g_free(scheduler->logdir);
+      scheduler->logdir    = g_strdup(tmp);
+      scheduler->logopened = TRUE;
+      scheduler->main_log  = log_new(scheduler->logdir, NULL, scheduler->s_pid);
+
+      if(main_log)
+      {
+        log_destroy(main_log);
+        main_log = scheduler->main_log;
+      }
     }
   }
 
-  /* load the host settings */
+  /* load the host settings. The fields are split in place on the string
+   * owned by the config so that a host line of any length parses without
+   * intermediate stack buffers. */
   keys = fo_config_key_set(scheduler->sysconfig, "HOSTS", &special);
   for(i = 0; i < special; i++)
   {
+    const char* addr;
+    const char* dir;
+    size_t addr_len, dir_len;
+    char* curr;
+    char* end;
+
     tmp = fo_config_get(scheduler->sysconfig, "HOSTS", keys[i], &error);
     if(error)
     {
@@ -888,16 +1025,32 @@ void scheduler_foss_config(scheduler_t* scheduler)
       continue;
     }
 
-    sscanf(tmp, "%s %s %d", addbuf, dirbuf, &max);
-    host = host_init(keys[i], addbuf, dirbuf, max);
+    curr = tmp;
+    while(isspace(*curr)) curr++;
+    addr = curr;
+    while(*curr && !isspace(*curr)) curr++;
+    addr_len = curr - addr;
+    while(isspace(*curr)) curr++;
+    dir = curr;
+    while(*curr && !isspace(*curr)) curr++;
+    dir_len = curr - dir;
+    max = (int32_t)strtol(curr, &end, 10);
+
+    if(addr_len == 0 || dir_len == 0 || end == curr)
+    {
+      WARNING("invalid host specification for host %s: %s", keys[i], tmp);
+      continue;
+    }
+    host = host_init_n(keys[i], addr, addr_len, dir, dir_len, max);
     host_insert(host, scheduler);
     if(TVERB_SCHED)
     {
-      log_printf("CONFIG: added new host\n");
-      log_printf("      name = %s\n", keys[i]);
-      log_printf("   address = %s\n", addbuf);
-      log_printf(" directory = %s\n", dirbuf);
-      log_printf("       max = %d\n", max);
+      log_printf("CONFIG: added new host\n"
+                 "      name = %s\n"
+                 "   address = %s\n"
+                 " directory = %s\n"
+                 "       max = %d\n",
+          host->name, host->address, host->agent_dir, host->max);
     }
   }
 
@@ -909,14 +1062,23 @@ void scheduler_foss_config(scheduler_t* scheduler)
     exit(254);
   }
 
-  /* load the version information */
+  /* load the version information. The VERSION file only changes when the
+   * installation is upgraded, so the parsed form is kept across config
+   * reloads and only rebuilt if the file's timestamp moves. */
   tmp = g_strdup_printf("%s/VERSION", scheduler->sysconfigdir);
-  version = fo_config_load(tmp, &error);
-  if(error) FATAL("%s", error->message);
+  if(version == NULL ||
+      (stat(tmp, &version_sb) == 0 && version_sb.st_mtime != version_mtime))
+  {
+    if(version != NULL)
+      fo_config_free(version);
+    version = fo_config_load(tmp, &error);
+    if(error) FATAL("%s", error->message);
+    if(stat(tmp, &version_sb) == 0)
+      version_mtime = version_sb.st_mtime;
+  }
   g_free(tmp);
 
   fo_config_join(scheduler->sysconfig, version, NULL);
-  fo_config_free(version);
 
   /* This will create the load and the print command for the special
    * configuration variables. This uses the l_op operation to load the variable
@@ -929,18 +1091,32 @@ void scheduler_foss_config(scheduler_t* scheduler)
    *
    *   this is generated:
    *
-   *     if(fo_config_has_key(sysconfig, "SCHEDULER", "test_variable")
-   *       CONF_test_variable = fo_config_get(sysconfig, "SCHEDULER",
-   *           "test_variable", NULL);
-   *     V_SPECIAL("CONFIG: %s == %s\n", "test_variable", CONF_test_variable);
+   *     if((tmp = fo_config_get(sysconfig, "SCHEDULER", "test_variable",
+   *         NULL)) != NULL)
+   *       CONF_test_variable = tmp;
+   *     if(conf_log != NULL)
+   *       g_string_append_printf(conf_log, "CONFIG: %s == %s\n",
+   *           "test_variable", CONF_test_variable);
    *
+   * The single fo_config_get with a NULL error doubles as the existence
+   * check, so each variable costs one tree lookup instead of two. The log
+   * lines are collected into one buffer and emitted with a single
+   * log_printf at the end instead of one call per variable.
    */
+  conf_log = TVERB_SPECIAL ? g_string_new("") : NULL;
 #define SELECT_CONF_INIT(type, name, l_op, w_op, val)                                  \
-  if(fo_config_has_key(scheduler->sysconfig, "SCHEDULER", #name))                      \
-    CONF_##name = l_op(fo_config_get(scheduler->sysconfig, "SCHEDULER", #name, NULL)); \
-  V_SPECIAL("CONFIG: %s == " MK_STRING_LIT(w_op) "\n", #name, CONF_##name );
+  if((tmp = fo_config_get(scheduler->sysconfig, "SCHEDULER", #name, NULL)) != NULL)    \
+    CONF_##name = l_op(tmp);                                                           \
+  if(conf_log != NULL)                                                                 \
+    g_string_append_printf(conf_log, "CONFIG: %s == " MK_STRING_LIT(w_op) "\n",       \
+        #name, CONF_##name );
   CONF_VARIABLES_TYPES(SELECT_CONF_INIT)
 #undef SELECT_CONF_INIT
+  if(conf_log != NULL)
+  {
+    log_printf("%s", conf_log->str);
+    g_string_free(conf_log, TRUE);
+  }
 }
 
 /**
@@ -972,13 +1148,20 @@ int scheduler_daemonize(scheduler_t* scheduler)
  */
 void scheduler_config_event(scheduler_t* scheduler, void* unused)
 {
+  agent_conf_batch* agent_conf;
+
   if(scheduler->sysconfig)
     scheduler_clear_config(scheduler);
 
   scheduler_foss_config(scheduler);
-  scheduler_agent_config(scheduler);
 
+  /* the agent configurations parse in the background while the database
+   * connection and checks run, overlapping the disk work with the
+   * network round trips */
+  agent_conf = scheduler_agent_config_start(scheduler);
   database_init(scheduler);
+  scheduler_agent_config_finish(scheduler, agent_conf);
+
   email_init(scheduler);
 }
 
@@ -1022,28 +1205,29 @@ void scheduler_test_agents(scheduler_t* scheduler, void* unused)
  */
 gint string_is_num(gchar* str)
 {
-  int len = strlen(str);
-  int i;
+  uint64_t chunk;
+  size_t len = strlen(str);
+  size_t i = 0;
+
+  /* check eight characters per step: after subtracting '0' from every
+   * byte and subtracting every byte from '9', a byte outside '0'..'9'
+   * leaves a high bit set in one of the two results. A borrow from a
+   * neighbouring byte can only flag extra bytes when an invalid byte is
+   * already present, so the test never misses. */
+  for(; i + 8 <= len; i += 8)
+  {
+    memcpy(&chunk, str + i, 8);
+    if(((chunk - 0x3030303030303030ULL) |
+        (0x3939393939393939ULL - chunk)) & 0x8080808080808080ULL)
+      return FALSE;
+  }
 
-  for(i = 0; i < len; i++)
+  for(; i < len; i++)
     if(!isdigit(str[i]))
       return FALSE;
   return TRUE;
 }
 
-/**
- * Utility function that enables the use of the strcmp function with a GTree.
- *
- * @param a The first string
- * @param b The second string
- * @param user_data unused in this function
- * @return Integral value indicating the relationship between the two strings
- */
-gint string_compare(gconstpointer a, gconstpointer b, gpointer user_data)
-{
-  return strcmp((char*)a, (char*)b);
-}
-
 /**
  * Utility function that enable the agents to be stored in a GTree using
  * the PID of the associated process.
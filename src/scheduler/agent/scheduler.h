@@ -132,6 +132,10 @@ with this program; if not, write to the Free Software Foundation, Inc.,
 
 #define AGENT_BINARY "%s/%s/%s/agent/%s"  ///< Format to get agent binary
 #define AGENT_CONF "mods-enabled"         ///< Agent conf location
+#define AGENT_CONF_THREADS 4                ///< Threads used to parse agent configs
+
+/** Opaque handle for an in-flight agent configuration parse batch */
+typedef struct agent_conf_batch agent_conf_batch;
 
 /**
  * Check if PGresult is not NULL. Then call PQclear and set result as NULL
@@ -161,15 +165,16 @@ typedef struct
     gchar*   sysconfigdir;  ///< The system directory that contain fossology.conf
     gchar*   logdir;        ///< The directory to put the log file in
     gboolean logcmdline;    ///< Was the log file set by the command line
+    gboolean logopened;     ///< Has the main log been opened from logdir
     log_t*   main_log;      ///< The main log file for the scheduler
 
     /* used exclusively in agent.c */
-    GTree*  meta_agents;    ///< List of all meta agents available to the scheduler
-    GTree*  agents;         ///< List of any currently running agents
+    GHashTable* meta_agents; ///< Map of all meta agents available to the scheduler, keyed by name
+    GHashTable* agents;     ///< List of any currently running agents, keyed by pid
 
     /* used exclusively in host.c */
-    GTree* host_list;       ///< List of all hosts available to the scheduler
-    GList* host_queue;      ///< Round-robin queue for choosing which host use next
+    GHashTable* host_list;  ///< Map of all hosts available to the scheduler, keyed by name
+    GQueue* host_queue;     ///< Round-robin queue for choosing which host use next
 
     /* used exclusively in interface.c */
     gboolean      i_created;    ///< Has the interface been created
@@ -194,7 +199,6 @@ typedef struct
     gboolean default_footer;  ///< Is the footer the default footer
 
     /* regular expressions */
-    GRegex* parse_agent_msg;     ///< Parses messages coming from the agents
     GRegex* parse_db_email;      ///< Parses database email text
     GRegex* parse_interface_cmd; ///< Parses the commands received by the interface
 } scheduler_t;
@@ -206,8 +210,6 @@ void scheduler_sig_handle(int signo);
 void scheduler_signal(scheduler_t* scheduler);
 void scheduler_update(scheduler_t* scheduler);
 
-void g_tree_clear(GTree* tree);
-
 extern int      verbose;
 extern int      closing;
 extern GThread* main_thread;
@@ -274,7 +276,6 @@ CONF_VARIABLES_TYPES(SELECT_DECLS)
 
 /* glib related functions */
 gint string_is_num(gchar* str);
-gint string_compare(gconstpointer a, gconstpointer b, gpointer user_data);
 gint int_compare(gconstpointer a, gconstpointer b, gpointer user_data);
 
 /* ************************************************************************** */
@@ -288,10 +289,13 @@ void scheduler_test_agents(scheduler_t* scheduler, void*);
 
 void scheduler_clear_config(scheduler_t* scheduler);
 void scheduler_agent_config(scheduler_t* scheduler);
+agent_conf_batch* scheduler_agent_config_start(scheduler_t* scheduler);
+void scheduler_agent_config_finish(scheduler_t* scheduler, agent_conf_batch* batch);
 void scheduler_foss_config(scheduler_t* scheduler);
 int  scheduler_daemonize(scheduler_t* scheduler);
 
 void set_usr_grp(gchar* process_name, fo_conf* config);
-int  kill_scheduler(int force);
+void scheduler_register_pid(scheduler_t* scheduler);
+int  kill_scheduler(int force, gchar* sysconfigdir);
 
 #endif /* SCHEDULER_H_INCLUDE */
@@ -123,8 +123,8 @@ void test_add_meta_agent()
   FO_ASSERT_TRUE(add_meta_agent(scheduler->meta_agents, "name", "cmd", 11, 1));
   FO_ASSERT_FALSE(add_meta_agent(scheduler->meta_agents, NULL, "cmd", 11, 1));
 
-  ma = g_tree_lookup(scheduler->meta_agents, "name");
-  FO_ASSERT_EQUAL(g_tree_nnodes(scheduler->meta_agents), 1);
+  ma = g_hash_table_lookup(scheduler->meta_agents, "name");
+  FO_ASSERT_EQUAL(g_hash_table_size(scheduler->meta_agents), 1);
   FO_ASSERT_PTR_NOT_NULL(ma);
   FO_ASSERT_STRING_EQUAL(ma->name, "name");
   FO_ASSERT_STRING_EQUAL(ma->raw_cmd, "cmd --scheduler_start");
@@ -133,7 +133,7 @@ void test_add_meta_agent()
   FO_ASSERT_PTR_NULL(ma->version);
   FO_ASSERT_TRUE(ma->valid);
 
-  g_tree_remove(scheduler->meta_agents, "name");
+  g_hash_table_remove(scheduler->meta_agents, "name");
   scheduler_destroy(scheduler);
 }
 
@@ -180,7 +180,6 @@ void test_agent_death_event()
   scheduler_t* scheduler;
   agent_t fagent;
   job_t   fjob;
-  int* pid_set = NULL;
   agent_t* a1;
 
   scheduler = scheduler_init(testdb, NULL);
@@ -198,13 +197,10 @@ void test_agent_death_event()
 
   create_pipe(&fagent.from_child, &fagent.to_parent, NULL, &fagent.write);
 
-  pid_set = g_new0(int, 2);
-  pid_set[0] = fagent.pid;
-  pid_set[1] = 0;
   fagent.return_code = 0;
 
-  agent_death_event(scheduler, pid_set);
-  a1 = g_tree_lookup(scheduler->agents, &fagent.pid);
+  agent_death_event(scheduler, agent_pack_death_event(fagent.pid, 0));
+  a1 = g_hash_table_lookup(scheduler->agents, GINT_TO_POINTER(fagent.pid));
 
   FO_ASSERT_EQUAL(fagent.status, AG_CREATED);
   FO_ASSERT_PTR_NULL(a1);
@@ -234,7 +230,6 @@ void test_agent_create_event()
   job_t*  fjob = NULL;
   agent_t* ag = NULL;
   GList* gl = NULL;
-  int* pid_set = NULL;
 
   static int32_t id_gen = -1;
   GList*  iter;
@@ -243,8 +238,8 @@ void test_agent_create_event()
   scheduler = scheduler_init(testdb, NULL);
   scheduler_config_event(scheduler, NULL);
 
-  meta_agent_t* ma = g_tree_lookup(scheduler->meta_agents, "copyright");
-  for(iter = scheduler->host_queue; iter != NULL; iter = iter->next)
+  meta_agent_t* ma = g_hash_table_lookup(scheduler->meta_agents, "copyright");
+  for(iter = scheduler->host_queue->head; iter != NULL; iter = iter->next)
   {
     host = (host_t*)iter->data;
     fjob = job_init(scheduler->job_list, scheduler->job_queue, ma->name,
@@ -258,7 +253,7 @@ void test_agent_create_event()
   /* test agent_create_event */
   agent_create_event(scheduler, fagent);
 
-  ag = g_tree_lookup(scheduler->agents, &fagent->pid);
+  ag = g_hash_table_lookup(scheduler->agents, GINT_TO_POINTER(fagent->pid));
   gl = g_list_find(fjob->running_agents, fagent);
 
   FO_ASSERT_PTR_NOT_NULL(ag);
@@ -275,32 +270,29 @@ void test_agent_create_event()
 
   /* test agent_ready_event */
   agent_ready_event(scheduler, fagent);
-  ag = g_tree_lookup(scheduler->agents, &fagent->pid);
+  ag = g_hash_table_lookup(scheduler->agents, GINT_TO_POINTER(fagent->pid));
 
   FO_ASSERT_PTR_NOT_NULL(ag);
   FO_ASSERT_EQUAL(fagent->status, AG_PAUSED);
 
   /* test agent fail event */
   agent_fail_event(scheduler, fagent);
-  ag = g_tree_lookup(scheduler->agents, &fagent->pid);
+  ag = g_hash_table_lookup(scheduler->agents, GINT_TO_POINTER(fagent->pid));
 
   FO_ASSERT_PTR_NOT_NULL(ag);
   FO_ASSERT_EQUAL(fagent->status, AG_FAILED);
 
   /* test agent update event */
   agent_update_event(scheduler, NULL);
-  ag = g_tree_lookup(scheduler->agents, &fagent->pid);
+  ag = g_hash_table_lookup(scheduler->agents, GINT_TO_POINTER(fagent->pid));
   FO_ASSERT_PTR_NOT_NULL(ag);
   FO_ASSERT_EQUAL(fagent->status, AG_FAILED);
 
-  pid_set = g_new0(int, 2);
-  pid_set[0] = fagent->pid;
-  pid_set[1] = 0;
   fagent->return_code = 0;
 
   /* test agent death event */
-  agent_death_event(scheduler, pid_set);
-  ag = g_tree_lookup(scheduler->agents, &fagent->pid);
+  agent_death_event(scheduler, agent_pack_death_event(fagent->pid, 0));
+  ag = g_hash_table_lookup(scheduler->agents, GINT_TO_POINTER(fagent->pid));
 
   FO_ASSERT_EQUAL(fagent->status, AG_FAILED);
   FO_ASSERT_PTR_NULL(ag);
@@ -326,8 +318,8 @@ void test_agent_init()
   scheduler = scheduler_init(testdb, NULL);
   scheduler_agent_config(scheduler);
 
-  meta_agent_t* ma = g_tree_lookup(scheduler->meta_agents, "copyright");
-  for(iter = scheduler->host_queue; iter != NULL; iter = iter->next)
+  meta_agent_t* ma = g_hash_table_lookup(scheduler->meta_agents, "copyright");
+  for(iter = scheduler->host_queue->head; iter != NULL; iter = iter->next)
   {
     host = (host_t*)iter->data;
     fjob = job_init(scheduler->job_list, scheduler->job_queue, ma->name,
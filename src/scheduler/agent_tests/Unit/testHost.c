@@ -78,19 +78,19 @@ void test_host_insert()
     name[0] = (char)('1' + i);
     host_insert(host_init(name, "localhost", "directory", i), scheduler);
 
-    list_size  = g_tree_nnodes(scheduler->host_list);
-    queue_size = g_list_length(scheduler->host_queue);
+    list_size  = g_hash_table_size(scheduler->host_list);
+    queue_size = g_queue_get_length(scheduler->host_queue);
     FO_ASSERT_EQUAL(list_size,  i + 1);
     FO_ASSERT_EQUAL(queue_size, i + 1);
   }
 
-  list_size  = g_tree_nnodes(scheduler->host_list);
-  queue_size = g_list_length(scheduler->host_queue);
+  list_size  = g_hash_table_size(scheduler->host_list);
+  queue_size = g_queue_get_length(scheduler->host_queue);
   FO_ASSERT_EQUAL(list_size,  9);
   FO_ASSERT_EQUAL(queue_size, 9);
 
   /* make sure they are in the correct order */
-  for(iter = scheduler->host_queue, i = 0; iter != NULL; iter = iter->next, i++)
+  for(iter = scheduler->host_queue->head, i = 0; iter != NULL; iter = iter->next, i++)
     FO_ASSERT_EQUAL(((host_t*)iter->data)->max, i);
 
   scheduler_destroy(scheduler);
@@ -165,23 +165,23 @@ void test_get_host()
 
   for(i = 0; i < 9; i++)
   {
-    host = get_host(&scheduler->host_queue, i + 1);
+    host = get_host(scheduler->host_queue, i + 1);
     name[0] = (char)('1' + i);
 
-    FO_ASSERT_PTR_EQUAL(host, g_tree_lookup(scheduler->host_list, name));
+    FO_ASSERT_PTR_EQUAL(host, g_hash_table_lookup(scheduler->host_list, name));
     FO_ASSERT_EQUAL(host->max, i + 1);
   }
 
-  host = get_host(&scheduler->host_queue, 3);
+  host = get_host(scheduler->host_queue, 3);
   FO_ASSERT_STRING_EQUAL(host->name, "3_local");
   FO_ASSERT_EQUAL(host->max, 3);
-  host = get_host(&scheduler->host_queue, 1);
+  host = get_host(scheduler->host_queue, 1);
   FO_ASSERT_STRING_EQUAL(host->name, "1_local");
   FO_ASSERT_EQUAL(host->max, 1);
-  host = get_host(&scheduler->host_queue, 9);
+  host = get_host(scheduler->host_queue, 9);
   FO_ASSERT_STRING_EQUAL(host->name, "9_local");
   FO_ASSERT_EQUAL(host->max, 9);
-  host = get_host(&scheduler->host_queue, 3);
+  host = get_host(scheduler->host_queue, 3);
   FO_ASSERT_STRING_EQUAL(host->name, "4_local");
   FO_ASSERT_EQUAL(host->max, 4);
 
@@ -101,7 +101,7 @@ void test_scheduler_daemonize()
   res = scheduler_daemonize(scheduler);
   FO_ASSERT_EQUAL(res, 0);
 
-  res = kill_scheduler(1);
+  res = kill_scheduler(1, testdb);
   FO_ASSERT_EQUAL(res, -1);
 
   scheduler_destroy(scheduler);
@@ -112,7 +112,7 @@ void test_scheduler_daemonize()
  * \test
  * -# Initialize scheduler and database
  * -# Call scheduler_clear_config()
- * -# Check for config pointers to be NULL
+ * -# Check for config pointers to be NULL and the database connection kept
  */
 void test_scheduler_clear_config()
 {
@@ -125,8 +125,8 @@ void test_scheduler_clear_config()
   FO_ASSERT_PTR_NOT_NULL(scheduler->db_conn);
 
   scheduler_clear_config(scheduler);
-  FO_ASSERT_PTR_NULL(scheduler->db_conn);
-  FO_ASSERT_PTR_NULL(scheduler->host_queue);
+  FO_ASSERT_PTR_NOT_NULL(scheduler->db_conn);
+  FO_ASSERT_EQUAL(g_queue_get_length(scheduler->host_queue), 0);
   FO_ASSERT_PTR_NULL(scheduler->host_url);
   FO_ASSERT_PTR_NULL(scheduler->email_subject);
   FO_ASSERT_PTR_NULL(scheduler->sysconfig);